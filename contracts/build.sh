@@ -18,7 +18,7 @@ if [ ! -d build ]; then
 fi
 OPT=-UNDEBUG
 cd build
-all=(storage/storage.cpp storage/confidential_storage.cpp token/arc20.cpp token/token_manager.cpp acl/acl.cpp token/confidential_token.cpp validator/plaintext_validator.cpp validator/confidential_validator.cpp multisig/multisig.cpp registry/registry.cpp)
+all=(storage/storage.cpp storage/confidential_storage.cpp token/arc20.cpp token/token_manager.cpp acl/acl.cpp token/confidential_token.cpp token/confidential_options_token.cpp validator/plaintext_validator.cpp validator/confidential_validator.cpp multisig/multisig.cpp registry/registry.cpp test/state_cache_test.cpp test/confidential_verify_test.cpp)
 
 if [ "$1" == "" ]; then
 	for obj in ${all[@]}; do
@@ -51,7 +51,7 @@ if [ "$WEB3J" ]; then
 		done
 	}
 
-	all=(storage confidential_storage arc20 token_manager acl confidential_token plaintext_validator confidential_validator multisig registry)
+	all=(storage confidential_storage arc20 token_manager acl confidential_token confidential_options_token plaintext_validator confidential_validator multisig registry state_cache_test confidential_verify_test)
 	if [ "$1" == "" ]; then
 		for obj in ${all[@]}; do
 			echo "Generate java wrapper class for ${obj}"
@@ -23,7 +23,7 @@ class ContractAuthority {
   const uint64_t kAuthorityKey = name_value("authority");
 };
 
-#define CREATE_UPDATE_CONTRACT(CONTRACT)                                       \
+#define CREATE_UPDATE_CONTRACT(CONTRACT, VERSION)                              \
   template <typename Proxy, typename Interface, Name::Raw ManagerName>         \
   class CreateUpdate##CONTRACT : public Interface,                             \
                                  public virtual ContractAuthority {            \
@@ -98,22 +98,33 @@ class ContractAuthority {
       get_state(sender.data(), sender.size, registry);                         \
                                                                                \
       Address version_address = manager_.VersionAddress(version);              \
-      Proxy proxy(sender);                                                     \
-      DEBUG("old version address", proxy.GetProxy().toString(),                \
-            "new version address", version_address.toString());                \
-      Address new_address = proxy.Migrate(version_address);                    \
-      privacy_assert(new_address != Address(0), "migrate failed");             \
+      uint8_t slots = CONTRACT##Slots(sender);                                 \
+      for (uint8_t slot = 0; slot < slots; slot++) {                           \
+        Proxy proxy(sender, slot);                                             \
+        DEBUG("old version address", proxy.GetProxy().toString(),              \
+              "new version address", version_address.toString());              \
+        Address new_address = proxy.Migrate(version_address);                  \
+        privacy_assert(new_address != Address(0), "migrate failed");           \
                                                                                \
-      proxy.UpdateProxy(sender, new_address);                                  \
-      registry.storage_version = version;                                      \
+        proxy.UpdateProxy(sender, new_address);                                \
+        DEBUG(#CONTRACT, new_address.toString());                              \
+      }                                                                        \
+      registry.VERSION = version;                                              \
       set_state<TokenRegistry, 60>(sender.data(), sender.size, registry);      \
                                                                                \
-      DEBUG(#CONTRACT, new_address.toString());                                \
-                                                                               \
       return true;                                                             \
     }                                                                          \
                                                                                \
    protected:                                                                  \
+    /**                                                                        \
+     * @brief Number of contracts of this kind used by an owner, each one is   \
+     * kept in its own proxy slot                                              \
+     *                                                                         \
+     * @param owner privacy contract address                                   \
+     * @return Number of slots, 1 by default                                   \
+     */                                                                        \
+    virtual uint8_t CONTRACT##Slots(const Address &owner) { return 1; }        \
+                                                                               \
     /**                                                                        \
      * @brief Deploy a certain version of the contract                         \
      *                                                                         \
@@ -130,10 +141,10 @@ class ContractAuthority {
   };
 
 // Define verification contract management class
-CREATE_UPDATE_CONTRACT(Validator)
+CREATE_UPDATE_CONTRACT(Validator, validator_version)
 
 // Define storage contract management class
-CREATE_UPDATE_CONTRACT(Storage)
+CREATE_UPDATE_CONTRACT(Storage, storage_version)
 
 using ValidatorManager =
     CreateUpdateValidator<ValidatorAdminProxy, ValidatorManagerInterface,
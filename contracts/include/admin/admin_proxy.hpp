@@ -3,19 +3,28 @@
 #include <platon/platon.h>
 
 namespace privacy {
+/*
+ * Address of the contract an owner uses for ProxyName, kept in the state of the
+ * admin contract. An owner may use several contracts of the same kind, each in
+ * its own slot, slot 0 keeps the original key.
+ *
+ * | owner(20) | ProxyName(8) | "proxy"(8) | slot(1, only when not 0) |
+ */
 template <Name::Raw ProxyName, typename T>
 class AdminProxy : public T {
  public:
-  AdminProxy(const Address &owner, const Address &proxy) {
+  AdminProxy(const Address &owner, const Address &proxy, uint8_t slot = 0) {
     privacy_assert(owner != Address(), "illegal owner address");
     privacy_assert(proxy != Address(), "illegal proxy address");
     setOwner(owner);
+    setSlot(slot);
     SetProxy(proxy);
     this->SetContractProxy(proxy);
   }
 
-  AdminProxy(const Address &owner) {
+  AdminProxy(const Address &owner, uint8_t slot = 0) {
     setOwner(owner);
+    setSlot(slot);
     this->SetContractProxy(GetProxy());
   }
 
@@ -28,7 +37,7 @@ class AdminProxy : public T {
   Address GetProxy() {
     SetProxyKey();
     Address proxy;
-    platon_get_state(owner_.data(), owner_.size(), proxy.data(), proxy.size);
+    platon_get_state(owner_.data(), key_size_, proxy.data(), proxy.size);
     return proxy;
   }
 
@@ -37,6 +46,11 @@ class AdminProxy : public T {
     std::copy(owner.data(), owner.data() + owner.size, owner_.data());
   }
 
+  void setSlot(uint8_t slot) {
+    owner_[kSlotOffset] = slot;
+    key_size_ = slot == 0 ? kSlotOffset : kSlotOffset + 1;
+  }
+
   Address getOwner() {
     Address result;
     std::copy(owner_.data(), owner_.data() + Address::size, result.data());
@@ -45,7 +59,7 @@ class AdminProxy : public T {
 
   void SetProxy(const Address &proxy) {
     SetProxyKey();
-    platon_set_state(owner_.data(), owner_.size(), proxy.data(), proxy.size);
+    platon_set_state(owner_.data(), key_size_, proxy.data(), proxy.size);
   }
 
   void SetProxyKey() {
@@ -55,7 +69,9 @@ class AdminProxy : public T {
   }
 
  private:
-  std::array<byte, 36> owner_{};
+  static constexpr size_t kSlotOffset = Address::size + 2 * sizeof(uint64_t);
+  std::array<byte, kSlotOffset + 1> owner_{};
+  size_t key_size_ = kSlotOffset;
   const uint64_t kProxyAddrKey[2] = {uint64_t(ProxyName),
                                      uint64_t(Name::Raw("proxy"_n))};
 };
@@ -30,6 +30,17 @@ struct Registry : public TokenRegistry {
                            (storage_addr)(validator_addr))
 };
 
+/**
+ * @brief Optional behaviours selected when a privacy contract registers.
+ */
+struct RegistryOptions {
+  uint32_t storage_options = 0;   // StorageOption flags
+  uint8_t storage_shards = 0;     // Number of storage shards, 0 means 1
+  bool shared_validator = false;  // Use the validator shared by the version
+  PLATON_SERIALIZE(RegistryOptions,
+                   (storage_options)(storage_shards)(shared_validator))
+};
+
 class ValidatorManagerInterface {
   /**
    * @brief Create a new type of validator template contract (first time
@@ -163,6 +174,24 @@ class AclInterface {
                               const platon::Address& token_address,
                               bool can_mint_burn) = 0;
 
+  /**
+   * @brief Privacy contract registration interface with optional behaviours
+   *
+   * @param validator_version validataor contract version number
+   * @param scaling_factor Scaling factor
+   * @param storage_version storage contract version number
+   * @param token_address token address
+   * @param can_mint_burn Whether to support minting and destruction
+   * @param options Optional behaviours of the registration
+   * @return Success returns true, failure triggers revert
+   */
+  virtual bool CreateRegistryWithOptions(uint32_t validator_version,
+                                         uint32_t storage_version,
+                                         u128 scaling_factor,
+                                         const platon::Address& token_address,
+                                         bool can_mint_burn,
+                                         const RegistryOptions& options) = 0;
+
   /**
    * @brief Transfer notes to others
    *
@@ -172,6 +201,16 @@ class AclInterface {
   virtual platon::bytesConstRef Transfer(
       const platon::bytesConstRef& proof) = 0;
 
+  /**
+   * @brief Switch the caller token to compact event mode, its transfers,
+   * mints and burns are then verified without the per-output detail event of
+   * the validator
+   *
+   * @param compact Whether the token emits compact events
+   * @return Success returns true, failure triggers revert
+   */
+  virtual bool SetCompactEvents(bool compact) = 0;
+
   /**
    * @brief Authorize other users to spend notes
    *
@@ -214,6 +253,16 @@ class AclInterface {
    */
   virtual Registry GetRegistry(const platon::Address& addr) = 0;
 
+  /**
+   * @brief Obtain the storage contracts of a privacy contract, a note is kept
+   * in the shard selected by the first byte of its hash
+   *
+   * @param addr privacy contract address
+   * @return Storage contract addresses in shard order
+   */
+  virtual std::vector<platon::Address> GetStorageShards(
+      const platon::Address& addr) = 0;
+
   /**
    * @brief Obtain privacy contract registration information
    *
@@ -222,6 +271,16 @@ class AclInterface {
    */
   virtual NoteStatus GetNote(const platon::h256& note_hash) = 0;
 
+  /**
+   * @brief Obtain the information of several notes
+   *
+   * @param note_hashes hash values of notes
+   * @return One NoteStatus for each hash in the same order, a note that does
+   * not exist is returned with a zero hash
+   */
+  virtual std::vector<NoteStatus> GetNotes(
+      const std::vector<platon::h256>& note_hashes) = 0;
+
   /**
    * @brief verification proof interface
    *
@@ -231,6 +290,17 @@ class AclInterface {
    */
   virtual platon::bytesConstRef ValidateProof(const platon::bytesConstRef& outputs) = 0;
 
+  /**
+   * @brief verification interface for several proofs of the caller's token,
+   * they are forwarded to the validator in one call
+   *
+   * @param proofs proof information
+   * @return Verification result of every proof in the same order, if any proof
+   * is illegal, trigger the revert operation with its batch index
+   */
+  virtual std::vector<platon::bytesConstRef> ValidateProofs(
+      const std::vector<platon::bytesConstRef>& proofs) = 0;
+
   /**
    * @brief Verify the legality of the signature
    *
@@ -14,17 +14,25 @@ class AclProxy : public ContractProxy {
  public:
   PROXY_INTERFACE(CreateRegistry, bool, uint32_t, uint32_t, u128,
                   const Address &, bool)
+  PROXY_INTERFACE(CreateRegistryWithOptions, bool, uint32_t, uint32_t, u128,
+                  const Address &, bool, const RegistryOptions &)
   PROXY_INTERFACE(ValidateProof, bytesConstRef, const bytesConstRef &)
+  PROXY_INTERFACE(ValidateProofs, std::vector<bytesConstRef>,
+                  const std::vector<bytesConstRef> &)
   PROXY_INTERFACE(Transfer, bytesConstRef, const bytesConstRef &)
+  PROXY_INTERFACE(SetCompactEvents, bool, bool)
   PROXY_INTERFACE_VOID(UpdateNotes, const bytesConstRef &)
   PROXY_INTERFACE(Approve, bytesConstRef, const bytesConstRef &)
   PROXY_INTERFACE(GetApproval, bytesConstRef, const h256 &)
   PROXY_INTERFACE(Mint, bytesConstRef, const bytesConstRef &)
   PROXY_INTERFACE(Burn, bytesConstRef, const bytesConstRef &)
   PROXY_INTERFACE(GetNote, NoteStatus, const h256 &)
+  PROXY_INTERFACE(GetNotes, std::vector<NoteStatus>,
+                  const std::vector<h256> &)
   PROXY_INTERFACE(ValidateSignature, bool, const bytesConstRef &, const h256 &,
                   const bytesConstRef &)
   PROXY_INTERFACE(GetRegistry, Registry, const Address &)
+  PROXY_INTERFACE(GetStorageShards, std::vector<Address>, const Address &)
   PROXY_INTERFACE(UpdateValidator, bool, uint32_t)
   PROXY_INTERFACE(UpdateStorage, bool, uint32_t)
   PROXY_INTERFACE(SupportProof, bool, uint32_t)
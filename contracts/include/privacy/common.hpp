@@ -15,6 +15,13 @@ class PrivacyRevert {
     pr.EmitRevert(log);
   }
 
+  // Index of the batch item being processed, it is reported with the revert
+  // log so that the caller knows which item failed, -1 outside of a batch
+  static int64_t &BatchIndex() {
+    static int64_t index = -1;
+    return index;
+  }
+
  private:
   void EmitRevert(const std::string &log) {
     PLATON_EMIT_EVENT0(PrivacyRevertEvent, log);
@@ -31,7 +38,12 @@ inline void privacy_assert_aux(bool cond, const char *cond_str, unsigned line,
                                Args &&... args) {
   if (!cond) {
     std::string all_info;
-    print(all_info, std::forward<Args>(args)...);
+    int64_t batch_index = PrivacyRevert::BatchIndex();
+    if (batch_index >= 0) {
+      print(all_info, "batch index:", batch_index, std::forward<Args>(args)...);
+    } else {
+      print(all_info, std::forward<Args>(args)...);
+    }
     println("Assertion failed:", cond_str, "func:", func, "line:", line,
             "file:", file, all_info);
     PrivacyRevert::Revert(all_info);
@@ -70,4 +70,34 @@ struct BurnExtra {
   PLATON_SERIALIZE(BurnExtra, (old_burn_hash));
 };
 
+// Field lists of the flat proof envelope, the confidential_tx followed by the
+// extra data of the proof type
+struct TransferFields : public TransferExtra {
+  platon::VectorWrapper confidential_tx;
+  PLATON_SERIALIZE(TransferFields, (confidential_tx)(public_owner)(
+                                       deposit_signature)(meta_data));
+};
+
+struct MintFields : public MintExtra {
+  platon::VectorWrapper confidential_tx;
+  PLATON_SERIALIZE(MintFields, (confidential_tx)(old_mint_hash)(meta_data));
+};
+
+struct BurnFields : public BurnExtra {
+  platon::VectorWrapper confidential_tx;
+  PLATON_SERIALIZE(BurnFields, (confidential_tx)(old_burn_hash));
+};
+
+/**
+ * @brief A confidential proof decoded from either envelope, only the extra
+ * data of the proof type is filled
+ */
+struct ConfidentialFields {
+  uint32_t version = 0;
+  platon::VectorWrapper confidential_tx;
+  TransferFields transfer;  // Transfer, deposit and withdraw
+  MintFields mint;
+  BurnFields burn;
+};
+
 }  // namespace privacy
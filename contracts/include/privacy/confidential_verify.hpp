@@ -0,0 +1,141 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+#include "privacy/confidential_utxo.h"
+
+/*
+ * Cryptographic verification of confidential transactions.
+ *
+ * platon_confidential_tx_verify verifies one confidential_tx and leaves the RLP
+ * of its ConfidentialUTXO as the variable length result. Every node provides
+ * it, so by default a set of transactions is verified with one such call per
+ * transaction. The default build therefore costs the same as verifying the
+ * proofs one by one, the batched verification only saves gas on nodes that
+ * provide the host function below.
+ *
+ * PRIVACY_BATCH_TX_VERIFY: the set is verified by
+ * platon_confidential_tx_verify_batch instead, which takes the RLP list of the
+ * confidential_tx blobs, verifies all their range proofs and signatures with
+ * one multi-exponentiation and leaves the RLP list of their ConfidentialUTXO as
+ * the variable length result. It returns the length of the result, zero or
+ * negative if any transaction is illegal. A contract built with it imports the
+ * batched host function and can only be deployed on nodes that provide it.
+ *
+ * PRIVACY_STUB_TX_VERIFY: the host functions are replaced by the node-free
+ * stub of privacy/debug/tx_verify_stub.hpp, for tests only. The batched path
+ * is still only compiled with PRIVACY_BATCH_TX_VERIFY.
+ */
+#ifdef PRIVACY_STUB_TX_VERIFY
+#include "privacy/debug/tx_verify_stub.hpp"
+#else
+#ifdef PRIVACY_BATCH_TX_VERIFY
+extern "C" {
+int32_t platon_confidential_tx_verify_batch(const uint8_t *txs, size_t len);
+}
+#endif
+
+namespace privacy {
+namespace host {
+inline int32_t TxVerify(const uint8_t *tx, size_t len) {
+  return ::platon_confidential_tx_verify(tx, len);
+}
+
+#ifdef PRIVACY_BATCH_TX_VERIFY
+inline int32_t TxVerifyBatch(const uint8_t *txs, size_t len) {
+  return ::platon_confidential_tx_verify_batch(txs, len);
+}
+#endif
+
+inline int32_t TxVerifyResult(uint8_t *result, size_t len) {
+  return ::platon_variable_length_result(result, len);
+}
+}  // namespace host
+}  // namespace privacy
+#endif
+
+namespace privacy {
+
+namespace internal {
+inline int32_t TxVerifyResult(int32_t result_len, bytes &result) {
+  if (result_len <= 0) return -1;
+  result.resize(result_len);
+  if (host::TxVerifyResult(result.data(), result.size()) <= 0) return -1;
+  return result_len;
+}
+
+// One host call per transaction, the results are assembled into the same list
+// the batched host function returns
+inline int32_t TxVerifyEach(const std::vector<VectorWrapper> &txs,
+                            bytes &result) {
+  RLPStream stream(txs.size());
+  bytes utxo;
+  for (auto &tx : txs) {
+    if (TxVerifyResult(host::TxVerify(tx.data(), tx.size()), utxo) <= 0) {
+      return -1;
+    }
+    stream.appendRaw(utxo);
+  }
+  result = stream.out();
+  return static_cast<int32_t>(result.size());
+}
+
+#ifdef PRIVACY_BATCH_TX_VERIFY
+// One host call for all the transactions
+inline int32_t TxVerifyAll(const std::vector<VectorWrapper> &txs,
+                           bytes &result) {
+  RLPStream stream(txs.size());
+  for (auto &tx : txs) stream << tx;
+  const bytesRef input = stream.out();
+  return TxVerifyResult(host::TxVerifyBatch(input.data(), input.size()),
+                        result);
+}
+#endif
+}  // namespace internal
+
+/**
+ * @brief Verify one confidential transaction
+ *
+ * @param tx confidential_tx blob of the transaction
+ * @param result Buffer of the verification result, the utxo references it so
+ * it has to outlive it
+ * @param utxo The ConfidentialUTXO of the transaction
+ * @return Return true if the transaction is legal
+ */
+inline bool ConfidentialTxVerify(const VectorWrapper &tx, bytes &result,
+                                 ConfidentialUTXO &utxo) {
+  if (internal::TxVerifyResult(host::TxVerify(tx.data(), tx.size()), result) <=
+      0) {
+    return false;
+  }
+  fetch(RLP(result), utxo);
+  return true;
+}
+
+/**
+ * @brief Verify several confidential transactions, with one host call each
+ * unless built with PRIVACY_BATCH_TX_VERIFY
+ *
+ * @param txs confidential_tx blobs of the transactions
+ * @param result Buffer of the verification results, the utxos reference it so
+ * it has to outlive them
+ * @param utxos The ConfidentialUTXO of every transaction, in the same order
+ * @return Return true if all the transactions are legal
+ */
+inline bool ConfidentialTxVerifyBatch(const std::vector<VectorWrapper> &txs,
+                                      bytes &result,
+                                      std::vector<ConfidentialUTXO> &utxos) {
+#ifdef PRIVACY_BATCH_TX_VERIFY
+  if (internal::TxVerifyAll(txs, result) <= 0) return false;
+#else
+  if (internal::TxVerifyEach(txs, result) <= 0) return false;
+#endif
+
+  RLP rlp(result);
+  if (rlp.itemCount() != txs.size()) return false;
+  utxos.resize(txs.size());
+  for (size_t i = 0; i < txs.size(); i++) fetch(rlp[i], utxos[i]);
+  return true;
+}
+
+}  // namespace privacy
@@ -66,6 +66,10 @@ class ValidatorProxyHelper : public ProxyHelper<ValidatorProxy> {
 
  public:
   PROXY_INTERFACE_HELPER(ValidateProof, platon::bytes, const platon::bytes &)
+  PROXY_INTERFACE_HELPER(ValidateCompactProof, platon::bytes,
+                         const platon::bytes &)
+  PROXY_INTERFACE_HELPER(ValidateProofs, std::vector<platon::bytes>,
+                         const std::vector<platon::bytes> &)
   PROXY_INTERFACE_HELPER(ValidateSignature, bool, const platon::bytes &,
                          const platon::h256 &, const platon::bytes &)
   PROXY_INTERFACE_HELPER(SupportProof, bool, uint32_t)
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+
+/*
+ * Node-free stand-in for the confidential verification host functions, used
+ * by contracts built with PRIVACY_STUB_TX_VERIFY. It runs without the
+ * cryptography of a node, so it must never be deployed as a real validator.
+ *
+ * A stub transaction is the RLP of the ConfidentialUTXO its verification
+ * returns. It is legal if it is an RLP list of the five ConfidentialUTXO
+ * fields, anything else is illegal. The result of the last call is kept until
+ * it is read, like the variable length result of the host.
+ */
+namespace privacy {
+namespace host {
+namespace stub {
+constexpr size_t kUTXOFields = 5;
+
+inline bytes &Result() {
+  static bytes result;
+  return result;
+}
+
+/**
+ * @brief Number of verification calls made so far, batched calls count once
+ */
+inline uint32_t &Calls() {
+  static uint32_t calls = 0;
+  return calls;
+}
+
+inline bool Legal(const RLP &tx) {
+  return tx.isList() && tx.itemCount() == kUTXOFields;
+}
+}  // namespace stub
+
+inline int32_t TxVerify(const uint8_t *tx, size_t len) {
+  stub::Calls()++;
+  RLP rlp(bytesConstRef(tx, len));
+  if (!stub::Legal(rlp)) return -1;
+  stub::Result().assign(tx, tx + len);
+  return static_cast<int32_t>(len);
+}
+
+inline int32_t TxVerifyBatch(const uint8_t *txs, size_t len) {
+  stub::Calls()++;
+  RLP rlp(bytesConstRef(txs, len));
+  if (!rlp.isList()) return -1;
+  RLPStream stream(rlp.itemCount());
+  for (size_t i = 0; i < rlp.itemCount(); i++) {
+    RLP tx(rlp[i].toBytesConstRef());
+    if (!stub::Legal(tx)) return -1;
+    stream.appendRaw(tx.data());
+  }
+  stub::Result() = stream.out();
+  return static_cast<int32_t>(stub::Result().size());
+}
+
+inline int32_t TxVerifyResult(uint8_t *result, size_t len) {
+  size_t size = std::min(len, stub::Result().size());
+  memcpy(result, stub::Result().data(), size);
+  return static_cast<int32_t>(size);
+}
+}  // namespace host
+}  // namespace privacy
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+#include "privacy/plaintext_utxo.h"
+
+namespace privacy {
+
+/*
+ * Digests of plaintext notes, equal to sha3 of the RLP encoding of
+ * PlaintextNote and SpenderNote. The note fields are encoded once into a
+ * reusable scratch buffer. The two encodings only differ in the list header
+ * and the trailing spender item, which are written around the shared fields.
+ *
+ * scratch: | header room(9) | owner | value | random | spender(21) |
+ */
+class NoteHasher {
+ public:
+  /**
+   * @brief Digest of a note
+   */
+  h256 NoteHash(const PlaintextNote &note) {
+    size_t fields = EncodeFields(note);
+    return HashList(fields);
+  }
+
+  /**
+   * @brief Digest of a note spent by spender, which is the message signed by
+   * the note owner, and digest of the note itself
+   */
+  void SpendHashes(const PlaintextNote &note, const Address &spender,
+                   h256 &spender_hash, h256 &note_hash) {
+    size_t fields = EncodeFields(note);
+    buffer_.push_back(static_cast<byte>(0x80 + spender.size));
+    buffer_.insert(buffer_.end(), spender.begin(), spender.end());
+    spender_hash = HashList(fields + 1 + spender.size);
+    note_hash = HashList(fields);
+  }
+
+ private:
+  // A list header is at most one byte plus an 8 byte length
+  static constexpr size_t kHeaderRoom = 9;
+
+  size_t EncodeFields(const PlaintextNote &note) {
+    buffer_.resize(kHeaderRoom);
+    AppendString(note.owner.data(), note.owner.size());
+    AppendNumber(note.value);
+    AppendString(note.random.data(), note.random.size());
+    return buffer_.size() - kHeaderRoom;
+  }
+
+  // The header of a list of the given payload size is written right before
+  // the fields, earlier headers are overwritten
+  h256 HashList(size_t payload) {
+    size_t start = kHeaderRoom;
+    if (payload < 56) {
+      buffer_[--start] = static_cast<byte>(0xc0 + payload);
+    } else {
+      size_t len_bytes = WriteLength(payload, start);
+      start -= len_bytes;
+      buffer_[--start] = static_cast<byte>(0xf7 + len_bytes);
+    }
+
+    h256 hash;
+    ::platon_sha3(buffer_.data() + start, kHeaderRoom - start + payload,
+                  hash.data(), hash.size);
+    return hash;
+  }
+
+  void AppendString(const byte *data, size_t size) {
+    if (size == 1 && data[0] < 0x80) {
+      buffer_.push_back(data[0]);
+      return;
+    }
+    if (size < 56) {
+      buffer_.push_back(static_cast<byte>(0x80 + size));
+    } else {
+      std::array<byte, sizeof(size_t)> length;
+      size_t len_bytes = BigEndian(size, length);
+      buffer_.push_back(static_cast<byte>(0xb7 + len_bytes));
+      buffer_.insert(buffer_.end(), length.end() - len_bytes, length.end());
+    }
+    buffer_.insert(buffer_.end(), data, data + size);
+  }
+
+  // Integers are encoded as their big endian bytes without leading zeros
+  void AppendNumber(u128 value) {
+    std::array<byte, sizeof(u128)> number;
+    size_t size = 0;
+    for (; value != 0; value >>= 8) {
+      number[number.size() - ++size] = static_cast<byte>(value & 0xff);
+    }
+    AppendString(number.data() + number.size() - size, size);
+  }
+
+  // Writes the big endian bytes of the length so that they end at end
+  size_t WriteLength(size_t length, size_t end) {
+    std::array<byte, sizeof(size_t)> bytes;
+    size_t len_bytes = BigEndian(length, bytes);
+    memcpy(buffer_.data() + end - len_bytes,
+           bytes.data() + bytes.size() - len_bytes, len_bytes);
+    return len_bytes;
+  }
+
+  size_t BigEndian(size_t value, std::array<byte, sizeof(size_t)> &out) {
+    size_t size = 0;
+    for (; value != 0; value >>= 8) {
+      out[out.size() - ++size] = static_cast<byte>(value & 0xff);
+    }
+    return size;
+  }
+
+  bytes buffer_;
+};
+
+}  // namespace privacy
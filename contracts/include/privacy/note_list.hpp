@@ -0,0 +1,150 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+
+namespace privacy {
+
+/**
+ * @brief One page of note hashes returned by a cursor query
+ */
+struct NotePage {
+  std::vector<platon::h256> notes;
+  platon::h256 cursor;  // The first note of the next page, zero at the end
+  PLATON_SERIALIZE(NotePage, (notes)(cursor))
+};
+
+/*
+ * Doubly linked list of note hashes kept in contract state, notes are
+ * enumerated in insertion order and can be removed in O(1). A note is in at
+ * most one list with the same name, lists with the same name are told apart by
+ * their scope.
+ *
+ * anchor: | name(8) | "anchor"(8) | scope | -> | head(32) | tail(32) |
+ * link:   | name(8) | note hash(32) |       -> | prev(32) | next(32) |
+ */
+template <Name::Raw ListName>
+class NoteList {
+ public:
+  static constexpr uint32_t kMaxPageSize = 200;
+
+  explicit NoteList(const bytesConstRef &scope) {
+    anchor_key_.resize(sizeof(kName) + sizeof(kAnchor) + scope.size());
+    memcpy(anchor_key_.data(), (const byte *)&kName, sizeof(kName));
+    memcpy(anchor_key_.data() + sizeof(kName), (const byte *)&kAnchor,
+           sizeof(kAnchor));
+    memcpy(anchor_key_.data() + sizeof(kName) + sizeof(kAnchor), scope.data(),
+           scope.size());
+  }
+
+  void Append(const h256 &hash) {
+    h256 head, tail;
+    GetLink(anchor_key_, head, tail);
+
+    SetLink(LinkKey(hash), tail, h256());
+    if (tail == h256()) {
+      head = hash;
+    } else {
+      std::array<byte, 40> tail_key = LinkKey(tail);
+      h256 prev, next;
+      GetLink(tail_key, prev, next);
+      SetLink(tail_key, prev, hash);
+    }
+    SetLink(anchor_key_, head, hash);
+  }
+
+  void Remove(const h256 &hash) {
+    std::array<byte, 40> key = LinkKey(hash);
+    h256 prev, next;
+    privacy_assert(GetLink(key, prev, next), "note is not in the list");
+
+    h256 head, tail;
+    GetLink(anchor_key_, head, tail);
+    if (prev == h256()) {
+      head = next;
+    } else {
+      std::array<byte, 40> prev_key = LinkKey(prev);
+      h256 prev_prev, prev_next;
+      GetLink(prev_key, prev_prev, prev_next);
+      SetLink(prev_key, prev_prev, next);
+    }
+    if (next == h256()) {
+      tail = prev;
+    } else {
+      std::array<byte, 40> next_key = LinkKey(next);
+      h256 next_prev, next_next;
+      GetLink(next_key, next_prev, next_next);
+      SetLink(next_key, prev, next_next);
+    }
+    if (head == h256()) {
+      ::platon_set_state(anchor_key_.data(), anchor_key_.size(), nullptr, 0);
+    } else {
+      SetLink(anchor_key_, head, tail);
+    }
+    ::platon_set_state(key.data(), key.size(), nullptr, 0);
+  }
+
+  /**
+   * @brief Get a page of notes
+   *
+   * @param cursor The first note of the page, zero to start from the head
+   * @param limit Maximum number of notes, capped to kMaxPageSize
+   * @return Notes of the page and the cursor of the next page, if the cursor
+   * note was removed in the meantime, trigger the revert operation
+   */
+  NotePage Page(const h256 &cursor, uint32_t limit) {
+    if (limit == 0 || limit > kMaxPageSize) limit = kMaxPageSize;
+
+    NotePage page;
+    h256 current = cursor;
+    if (current == h256()) {
+      h256 tail;
+      GetLink(anchor_key_, current, tail);
+    }
+
+    while (current != h256() && page.notes.size() < limit) {
+      h256 prev, next;
+      privacy_assert(GetLink(LinkKey(current), prev, next), "invalid cursor");
+      page.notes.push_back(current);
+      current = next;
+    }
+    page.cursor = current;
+    return page;
+  }
+
+ private:
+  template <typename Key>
+  bool GetLink(const Key &key, h256 &first, h256 &second) {
+    std::array<byte, 64> value;
+    if (::platon_get_state_length(key.data(), key.size()) != value.size()) {
+      first = h256();
+      second = h256();
+      return false;
+    }
+    ::platon_get_state(key.data(), key.size(), value.data(), value.size());
+    memcpy(first.data(), value.data(), first.size);
+    memcpy(second.data(), value.data() + first.size, second.size);
+    return true;
+  }
+
+  template <typename Key>
+  void SetLink(const Key &key, const h256 &first, const h256 &second) {
+    std::array<byte, 64> value;
+    memcpy(value.data(), first.data(), first.size);
+    memcpy(value.data() + first.size, second.data(), second.size);
+    ::platon_set_state(key.data(), key.size(), value.data(), value.size());
+  }
+
+  std::array<byte, 40> LinkKey(const h256 &hash) {
+    std::array<byte, 40> key;
+    memcpy(key.data(), (const byte *)&kName, sizeof(kName));
+    memcpy(key.data() + sizeof(kName), hash.data(), hash.size);
+    return key;
+  }
+
+  const uint64_t kName = uint64_t(ListName);
+  const uint64_t kAnchor = uint64_t(Name::Raw("anchor"_n));
+  bytes anchor_key_;
+};
+
+}  // namespace privacy
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+#include "privacy/utxo.h"
+
+namespace privacy {
+
+/*
+ * Note record stored under the note hash.
+ *
+ * | format(1) | sender id(4, big endian) | owner length(2, big endian) |
+ * | owner |
+ *
+ * The approval of a note is kept under its own key, kSenderIdApproved marks
+ * the notes that have one so that spending other notes skips that key.
+ *
+ * A storage that may find the note elsewhere (e.g. in its predecessor) keeps
+ * spent notes as a one byte kSpent record instead of deleting them.
+ *
+ * The note hash is the state key, so it is not repeated in the record, and the
+ * sender is replaced by its id in the SenderTable. The format tag is always
+ * below the RLP list prefix, records written by earlier versions (RLP encoded
+ * NoteStatus, or the record with the full sender address) are still decoded on
+ * read.
+ */
+enum class NoteRecordFormat : byte {
+  kSender = 1,
+  kSenderId = 2,
+  kSpent = 3,
+  kSenderIdApproved = 4,  // kSenderId layout, the note has an approval
+};
+
+// Result of looking a note up in the local state
+enum class NoteLookup { kMissing, kFound, kSpent };
+
+constexpr size_t kSenderRecordHeaderSize = 1 + Address::size + 2;
+constexpr size_t kNoteRecordHeaderSize = 1 + sizeof(uint32_t) + 2;
+constexpr byte kRlpListPrefix = 0xc0;
+
+/*
+ * Append-only dictionary of note senders, address -> compact id. Ids start
+ * from 1 and are never reused.
+ */
+class SenderTable {
+ public:
+  uint32_t Intern(const bytesConstRef &sender) {
+    privacy_assert(sender.size() == Address::size, "illegal note sender");
+    std::array<byte, 28> id_key = IdKey(sender);
+    uint32_t id = 0;
+    if (::platon_get_state_length(id_key.data(), id_key.size()) != 0) {
+      ::platon_get_state(id_key.data(), id_key.size(), (byte *)&id,
+                         sizeof(id));
+      return id;
+    }
+
+    if (::platon_get_state_length((const byte *)&kSenderCount,
+                                  sizeof(kSenderCount)) != 0) {
+      ::platon_get_state((const byte *)&kSenderCount, sizeof(kSenderCount),
+                         (byte *)&id, sizeof(id));
+    }
+    id++;
+    ::platon_set_state((const byte *)&kSenderCount, sizeof(kSenderCount),
+                       (const byte *)&id, sizeof(id));
+    ::platon_set_state(id_key.data(), id_key.size(), (const byte *)&id,
+                       sizeof(id));
+    std::array<byte, 12> sender_key = SenderKey(id);
+    ::platon_set_state(sender_key.data(), sender_key.size(), sender.data(),
+                       sender.size());
+    DEBUG("intern sender:", toHex(sender), "id:", id);
+    return id;
+  }
+
+  void Resolve(uint32_t id, bytes &sender) {
+    std::array<byte, 12> sender_key = SenderKey(id);
+    sender.resize(Address::size);
+    int32_t len = ::platon_get_state(sender_key.data(), sender_key.size(),
+                                     sender.data(), sender.size());
+    privacy_assert(len == Address::size, "unknown note sender id");
+  }
+
+ private:
+  std::array<byte, 28> IdKey(const bytesConstRef &sender) {
+    std::array<byte, 28> key;
+    memcpy(key.data(), (const byte *)&kSenderIdPrefix,
+           sizeof(kSenderIdPrefix));
+    memcpy(key.data() + sizeof(kSenderIdPrefix), sender.data(),
+           Address::size);
+    return key;
+  }
+
+  std::array<byte, 12> SenderKey(uint32_t id) {
+    std::array<byte, 12> key;
+    memcpy(key.data(), (const byte *)&kSenderPrefix, sizeof(kSenderPrefix));
+    memcpy(key.data() + sizeof(kSenderPrefix), (const byte *)&id, sizeof(id));
+    return key;
+  }
+
+  const uint64_t kSenderIdPrefix = uint64_t(Name::Raw("sender_id"_n));
+  const uint64_t kSenderPrefix = uint64_t(Name::Raw("sender"_n));
+  const uint64_t kSenderCount = uint64_t(Name::Raw("sender_count"_n));
+};
+
+inline void EncodeNoteRecord(const bytesConstRef &owner, uint32_t sender_id,
+                             bytes &record) {
+  privacy_assert(owner.size() <= 0xFFFF, "note owner is too long");
+
+  record.resize(kNoteRecordHeaderSize + owner.size());
+  record[0] = static_cast<byte>(NoteRecordFormat::kSenderId);
+  record[1] = static_cast<byte>(sender_id >> 24);
+  record[2] = static_cast<byte>(sender_id >> 16);
+  record[3] = static_cast<byte>(sender_id >> 8);
+  record[4] = static_cast<byte>(sender_id);
+  record[5] = static_cast<byte>(owner.size() >> 8);
+  record[6] = static_cast<byte>(owner.size());
+  memcpy(record.data() + kNoteRecordHeaderSize, owner.data(), owner.size());
+}
+
+inline bool IsSpentRecord(const bytesConstRef &record) {
+  return record.size() == 1 &&
+         record[0] == static_cast<byte>(NoteRecordFormat::kSpent);
+}
+
+// Whether the approval key of the note has to be cleared when it is spent,
+// records written before the approval flag always do
+inline bool MayHaveApproval(const bytesConstRef &record) {
+  return record[0] != static_cast<byte>(NoteRecordFormat::kSenderId);
+}
+
+inline void DecodeNoteRecord(const h256 &hash, const bytesConstRef &record,
+                             SenderTable &senders, NoteStatus &status) {
+  privacy_assert(!record.empty(), "illegal note record");
+
+  // legacy RLP encoded NoteStatus
+  if (record[0] >= kRlpListPrefix) {
+    fetch(RLP(record), status);
+    return;
+  }
+
+  size_t header_size = 0;
+  switch (static_cast<NoteRecordFormat>(record[0])) {
+    case NoteRecordFormat::kSender:
+      header_size = kSenderRecordHeaderSize;
+      privacy_assert(record.size() >= header_size, "illegal note record");
+      status.sender.assign(record.data() + 1,
+                           record.data() + 1 + Address::size);
+      break;
+    case NoteRecordFormat::kSenderId:
+    case NoteRecordFormat::kSenderIdApproved:
+      header_size = kNoteRecordHeaderSize;
+      privacy_assert(record.size() >= header_size, "illegal note record");
+      senders.Resolve((uint32_t(record[1]) << 24) |
+                          (uint32_t(record[2]) << 16) |
+                          (uint32_t(record[3]) << 8) | record[4],
+                      status.sender);
+      break;
+    default:
+      privacy_assert(false, "unknown note record format");
+  }
+
+  size_t owner_len =
+      (size_t(record[header_size - 2]) << 8) | record[header_size - 1];
+  privacy_assert(record.size() == header_size + owner_len,
+                 "illegal note record length");
+
+  status.hash = hash;
+  status.owner.assign(record.data() + header_size,
+                      record.data() + record.size());
+}
+
+}  // namespace privacy
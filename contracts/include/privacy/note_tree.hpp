@@ -0,0 +1,122 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+
+namespace privacy {
+
+/*
+ * Append-only Merkle tree of created note hashes. Empty subtrees hash to the
+ * zero hash of their level: zero[0] = 0, zero[l + 1] = sha3(zero[l] | zero[l]).
+ *
+ * Only the frontier is stored: for every level the last completed node whose
+ * right neighbour is not completed yet, at most kDepth + 1 slots whatever the
+ * number of leaves. It is enough to update and compute the root but not to
+ * build inclusion paths, those are built off chain from the leaves, which the
+ * storages publish in creation order with their NoteTreeEvent.
+ *
+ * A leaf costs one hash and one read for every node it completes, amortized
+ * one of each, and the frontier slots are written once per Flush.
+ *
+ * count:    | "tree_size"(8) |            -> | leaves(8) |
+ * frontier: | "tree_edge"(8) | level(1) |  -> | hash(32) |
+ */
+class NoteTree {
+ public:
+  static constexpr uint32_t kDepth = 32;
+
+  NoteTree() {
+    ::platon_get_state((const byte *)&kSize, sizeof(kSize), (byte *)&size_,
+                       sizeof(size_));
+  }
+
+  uint64_t Size() const { return size_; }
+
+  /**
+   * @brief Append a leaf, the tree is only persisted by Flush
+   */
+  void Append(const h256 &leaf) {
+    privacy_assert(size_ < (uint64_t(1) << kDepth), "note tree is full");
+    uint64_t index = size_++;
+    h256 node = leaf;
+    uint32_t level = 0;
+    for (; (index & 1) == 1; level++, index >>= 1) {
+      node = Hash(Frontier(level), node);
+    }
+    frontier_[level] = node;
+    loaded_ |= uint64_t(1) << level;
+    dirty_ |= uint64_t(1) << level;
+  }
+
+  void Flush() {
+    for (uint32_t level = 0; level <= kDepth; level++) {
+      if ((dirty_ & (uint64_t(1) << level)) == 0) continue;
+      std::array<byte, 9> key = FrontierKey(level);
+      ::platon_set_state(key.data(), key.size(), frontier_[level].data(),
+                         frontier_[level].size);
+    }
+    dirty_ = 0;
+    ::platon_set_state((const byte *)&kSize, sizeof(kSize),
+                       (const byte *)&size_, sizeof(size_));
+  }
+
+  h256 Root() {
+    if ((size_ >> kDepth) != 0) return Frontier(kDepth);
+    h256 node;
+    for (uint32_t level = 0; level < kDepth; level++) {
+      if ((size_ & (uint64_t(1) << level)) != 0) {
+        node = Hash(Frontier(level), node);
+      } else {
+        node = Hash(node, ZeroHash(level));
+      }
+    }
+    return node;
+  }
+
+ private:
+  h256 Hash(const h256 &left, const h256 &right) {
+    std::array<byte, 64> input;
+    memcpy(input.data(), left.data(), left.size);
+    memcpy(input.data() + left.size, right.data(), right.size);
+    h256 hash;
+    ::platon_sha3(input.data(), input.size(), hash.data(), hash.size);
+    return hash;
+  }
+
+  const h256 &ZeroHash(uint32_t level) {
+    if (zeros_.empty()) {
+      zeros_.resize(kDepth + 1);
+      for (uint32_t i = 0; i < kDepth; i++) {
+        zeros_[i + 1] = Hash(zeros_[i], zeros_[i]);
+      }
+    }
+    return zeros_[level];
+  }
+
+  const h256 &Frontier(uint32_t level) {
+    if ((loaded_ & (uint64_t(1) << level)) == 0) {
+      std::array<byte, 9> key = FrontierKey(level);
+      ::platon_get_state(key.data(), key.size(), frontier_[level].data(),
+                         frontier_[level].size);
+      loaded_ |= uint64_t(1) << level;
+    }
+    return frontier_[level];
+  }
+
+  std::array<byte, 9> FrontierKey(uint32_t level) {
+    std::array<byte, 9> key;
+    memcpy(key.data(), (const byte *)&kEdge, sizeof(kEdge));
+    key[sizeof(kEdge)] = static_cast<byte>(level);
+    return key;
+  }
+
+  const uint64_t kSize = uint64_t(Name::Raw("tree_size"_n));
+  const uint64_t kEdge = uint64_t(Name::Raw("tree_edge"_n));
+  uint64_t size_ = 0;
+  std::array<h256, kDepth + 1> frontier_;
+  uint64_t loaded_ = 0;  // Levels of frontier_ read from the state
+  uint64_t dirty_ = 0;   // Levels of frontier_ to write by Flush
+  std::vector<h256> zeros_;
+};
+
+}  // namespace privacy
@@ -1,19 +1,23 @@
 #pragma once
 #include <platon/platon.h>
 #include "common.hpp"
+#include "platon/vector_wrapper.hpp"
 namespace privacy {
 
+// The byte fields are views over the decoded call input, so decoding a proof
+// does not copy it
 struct PlaintextProof {
   // Proof data, each proof type has a corresponding contract, no external
   // pointing type is required.
-  platon::bytes data;
-  platon::bytes signature;
+  platon::VectorWrapper data;
+  platon::VectorWrapper signature;
   PLATON_SERIALIZE(PlaintextProof, (data)(signature));
 };
 
 struct PlaintextData {
-  uint32_t version;    // Version information of specific parameters
-  platon::bytes data;  // Find the decoder to decode according to version
+  uint32_t version;  // Version information of specific parameters
+  platon::VectorWrapper
+      data;  // Find the decoder to decode according to version
   PLATON_SERIALIZE(PlaintextData, (version)(data));
 };
 
@@ -24,13 +28,13 @@ struct PlaintextData {
 //};
 
 struct PlaintextNote {
-  platon::bytes owner;
+  platon::VectorWrapper owner;
   platon::u128 value;
-  platon::bytes random;
+  platon::VectorWrapper random;
   PLATON_SERIALIZE(PlaintextNote, (owner)(value)(random))
 };
 struct PlaintextOutputNote : public PlaintextNote {
-  platon::bytes meta_data;
+  platon::VectorWrapper meta_data;
   PLATON_SERIALIZE(PlaintextOutputNote, (owner)(value)(random)(meta_data));
 };
 
@@ -39,7 +43,7 @@ struct SpenderNote : public PlaintextNote {
   PLATON_SERIALIZE(SpenderNote, (owner)(value)(random)(spender));
 };
 struct PlaintextInputNote : public SpenderNote {
-  platon::bytes signature;
+  platon::VectorWrapper signature;
   PLATON_SERIALIZE(PlaintextInputNote, (owner)(value)(random)(signature));
 };
 
@@ -49,13 +53,13 @@ struct PlaintextUTXO {
   platon::Address public_owner;  // The transfer account of the public amount
   i128 public_value;  // Disclosure amount, amount transferred in or out from
                       // the privacy contract
-  platon::bytes meta_data;  // Remarks information
+  platon::VectorWrapper meta_data;  // Remarks information
   PLATON_SERIALIZE(PlaintextUTXO,
                    (inputs)(outputs)(public_owner)(public_value)(meta_data));
 };
 
 struct PlaintextApprove : public PlaintextNote {
-  platon::bytes shared_sign;  // Shared signature
+  platon::VectorWrapper shared_sign;  // Shared signature
   PLATON_SERIALIZE(PlaintextApprove, (owner)(value)(random)(shared_sign));
 };
 
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+
+namespace privacy {
+
+/*
+ * Digests of one proof, shared by every stage of its validation. The sha3 of
+ * the signed proof data and the address recovered from the proof signature are
+ * computed on first use and at most once per proof.
+ */
+class ProofDigest {
+ public:
+  ProofDigest() = default;
+
+  /**
+   * @brief Digest context of a proof, the bytes are referenced and have to
+   * outlive the context
+   *
+   * @param data Signed proof data
+   * @param signature Signature of the proof data
+   */
+  ProofDigest(const bytesConstRef &data, const bytesConstRef &signature)
+      : data_(data), signature_(signature) {}
+
+  /**
+   * @brief sha3 of the proof data
+   */
+  const h256 &DataHash() {
+    if (!hashed_) {
+      ::platon_sha3(data_.data(), data_.size(), data_hash_.data(),
+                    data_hash_.size);
+      hashed_ = true;
+    }
+    return data_hash_;
+  }
+
+  /**
+   * @brief Address recovered from the proof signature, zero if the signature
+   * can not be recovered
+   */
+  const Address &Signer() {
+    if (!recovered_) {
+      const h256 &hash = DataHash();
+      if (0 != ::platon_ecrecover(hash.data(), signature_.data(),
+                                  signature_.size(), signer_.data())) {
+        signer_ = Address();
+      }
+      recovered_ = true;
+    }
+    return signer_;
+  }
+
+ private:
+  bytesConstRef data_;
+  bytesConstRef signature_;
+  h256 data_hash_;
+  Address signer_;
+  bool hashed_ = false;
+  bool recovered_ = false;
+};
+
+}  // namespace privacy
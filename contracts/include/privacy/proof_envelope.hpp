@@ -0,0 +1,74 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+
+namespace privacy {
+
+/*
+ * Flat proof envelope, used by the proofs of major version kFlatProofMajor.
+ *
+ * | version(4) | fields | signature(65) |
+ *
+ * version is big endian, fields is one RLP list holding every field of the
+ * proof, and signature signs the sha3 of version and fields. The older
+ * envelope nests the version and the fields in RLP strings of an RLP list:
+ * RLP{RLP{version, fields...}, signature}.
+ *
+ * An older proof starts with an RLP list header, which is at least 0xc0. A
+ * flat proof starts with the version category, which is far below that, so
+ * the first byte tells the two envelopes apart.
+ */
+constexpr uint8_t kFlatProofMajor = 2;
+constexpr size_t kFlatVersionSize = 4;
+constexpr size_t kFlatSignatureSize = 65;
+
+/**
+ * @brief The parts of a flat proof, they reference the proof bytes
+ */
+struct FlatProof {
+  uint32_t version = 0;
+  bytesConstRef signed_data;  // version and fields, the signed message
+  bytesConstRef fields;       // RLP list of the proof fields
+  bytesConstRef signature;
+};
+
+/**
+ * @brief Whether the version belongs to the flat envelope
+ */
+inline bool FlatProofVersion(uint32_t version) {
+  return static_cast<uint8_t>((version & 0x00FF0000) >> 16) == kFlatProofMajor;
+}
+
+/**
+ * @brief Whether the proof uses the flat envelope
+ */
+inline bool IsFlatProof(const bytesConstRef &proof) {
+  return proof.size() > 0 && proof[0] < 0xc0;
+}
+
+/**
+ * @brief Split a flat proof into its parts
+ *
+ * @param proof Proof byte stream
+ * @param flat The parts of the proof
+ * @return Return false if the proof is too short or its version does not
+ * belong to the flat envelope
+ */
+inline bool OpenFlatProof(const bytesConstRef &proof, FlatProof &flat) {
+  if (proof.size() < kFlatVersionSize + kFlatSignatureSize) return false;
+
+  flat.version = 0;
+  for (size_t i = 0; i < kFlatVersionSize; i++) {
+    flat.version = (flat.version << 8) | proof[i];
+  }
+  size_t signed_size = proof.size() - kFlatSignatureSize;
+  flat.signed_data = bytesConstRef(proof.data(), signed_size);
+  flat.fields = bytesConstRef(proof.data() + kFlatVersionSize,
+                              signed_size - kFlatVersionSize);
+  flat.signature =
+      bytesConstRef(proof.data() + signed_size, kFlatSignatureSize);
+  return FlatProofVersion(flat.version);
+}
+
+}  // namespace privacy
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include "privacy/validator_interface.hpp"
+
+namespace privacy {
+
+/*
+ * Compile-time dispatch of proofs to validator handlers.
+ *
+ * A validator lists one ProofHandler for every (major, minor, ProofType) it
+ * serves in a constexpr table, so one deployed validator can accept several
+ * proof versions, each with its own handler. Only the listed handlers are
+ * referenced, a handler that is left out of the table is not linked into the
+ * contract. Lookups of a constant version are folded by the compiler, lookups
+ * of a runtime version scan the few entries of the table.
+ *
+ * version: | category(8) | major(8) | minor(8) | type(8) |
+ * The category byte is not part of the lookup, each category has its own
+ * validator.
+ */
+constexpr uint32_t kProofVersionMask = 0x00FFFFFF;
+
+/**
+ * @brief Version key of a handler, the proof version without the category
+ */
+constexpr uint32_t ProofVersion(uint8_t major, uint8_t minor, ProofType type) {
+  return (uint32_t(major) << 16) | (uint32_t(minor) << 8) | uint32_t(type);
+}
+
+/**
+ * @brief A validator member function registered for one proof version
+ */
+template <typename Handler>
+struct ProofHandler {
+  uint32_t version;  // ProofVersion of the proofs it validates
+  Handler handler;
+};
+
+/**
+ * @brief Find the handler of a proof version
+ *
+ * @param handlers Handler table of the validator
+ * @param version Proof version, the category byte is ignored
+ * @return The registered handler, nullptr if the version is not served
+ */
+template <typename Handler, size_t N>
+constexpr Handler FindProofHandler(
+    const std::array<ProofHandler<Handler>, N> &handlers, uint32_t version) {
+  for (size_t i = 0; i < N; i++) {
+    if (handlers[i].version == (version & kProofVersionMask)) {
+      return handlers[i].handler;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Whether every version of the table has exactly one handler, meant
+ * for a static_assert next to the table
+ */
+template <typename Handler, size_t N>
+constexpr bool UniqueProofHandlers(
+    const std::array<ProofHandler<Handler>, N> &handlers) {
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = i + 1; j < N; j++) {
+      if (handlers[i].version == handlers[j].version) return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace privacy
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+#include "privacy/state_cache.hpp"
+
+namespace privacy {
+
+/*
+ * Spent notes of a storage created with kSpentMarker. The record of a spent
+ * note is erased like in the default layout, and the note is added to this
+ * set, which is only read when notes are created, so spending stays one read
+ * of the live record. Live records are not kept in an append-only set: a
+ * spent record would then stay in state next to its marker, while the marker
+ * alone already blocks the re-creation of the hash.
+ *
+ * A spent note is recorded under the first kTagSize bytes of its hash, 17
+ * bytes of key and value per spent note instead of the 33 bytes of a marker
+ * under the full hash. Two hashes sharing a tag make the creation of the
+ * second one fail, with probability about created * spent / 2^64, which is
+ * below 1e-7 at 1M notes. A double spend is never accepted because of it.
+ *
+ * marker: | "spent"(8) | hash tag(8) | -> | 1 |
+ */
+class SpentSet {
+ public:
+  static constexpr size_t kTagSize = 8;
+  static constexpr size_t kValueSize = 1;
+
+  explicit SpentSet(StateCache &cache) : cache_(cache) {}
+
+  bool Contains(const h256 &hash) {
+    std::array<byte, 16> key = Key(hash);
+    return cache_.Get(bytesConstRef(key.data(), key.size())) != nullptr;
+  }
+
+  void Add(const h256 &hash) {
+    std::array<byte, 16> key = Key(hash);
+    byte marker = 1;
+    cache_.Set(bytesConstRef(key.data(), key.size()),
+               bytesConstRef(&marker, sizeof(marker)));
+  }
+
+ private:
+  std::array<byte, 16> Key(const h256 &hash) {
+    std::array<byte, 16> key;
+    memcpy(key.data(), (const byte *)&kSpent, sizeof(kSpent));
+    memcpy(key.data() + sizeof(kSpent), hash.data(), kTagSize);
+    return key;
+  }
+
+  StateCache &cache_;
+  const uint64_t kSpent = uint64_t(Name::Raw("spent"_n));
+};
+
+}  // namespace privacy
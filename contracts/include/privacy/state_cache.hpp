@@ -0,0 +1,171 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+
+namespace privacy {
+
+/*
+ * Write-combining cache of contract state for the keys touched by one action.
+ * Reads go through the cache, writes are buffered and Flush sends the last
+ * value of every changed key to the host once. A key that did not exist
+ * before the action and is erased again is not written at all.
+ *
+ * Entries live in an open-addressed table with linear probing, keys are
+ * placed by their last 4 bytes, which are note hash bytes for every key the
+ * storages cache.
+ */
+class StateCache {
+ public:
+  static constexpr size_t kMaxKeySize = 40;
+
+  StateCache() : entries_(kInitialCapacity) {}
+
+  /**
+   * @brief Current value of a key
+   *
+   * @return The value, nullptr when the key does not exist. The pointer is
+   * only valid until the next access to the cache.
+   */
+  const bytes *Get(const bytesConstRef &key) {
+    Entry &entry = Load(key);
+    return entry.present ? &entry.value : nullptr;
+  }
+
+  void Set(const bytesConstRef &key, const bytesConstRef &value) {
+    Entry &entry = Touch(key);
+    entry.value.assign(value.data(), value.data() + value.size());
+    entry.present = true;
+    entry.dirty = true;
+  }
+
+  void Erase(const bytesConstRef &key) {
+    Entry &entry = Touch(key);
+    entry.value.clear();
+    entry.present = false;
+    entry.dirty = true;
+  }
+
+  /**
+   * @brief Number of slots of the table, for tests and gas measurements
+   */
+  size_t Capacity() const { return entries_.size(); }
+
+  /**
+   * @brief Write the changed keys to the state, the cache stays valid
+   */
+  void Flush() {
+    size_t writes = 0;
+    for (auto &entry : entries_) {
+      if (!entry.used || !entry.dirty) continue;
+      entry.dirty = false;
+      if (entry.present) {
+        ::platon_set_state(entry.key.data(), entry.key_size,
+                           entry.value.data(), entry.value.size());
+        entry.existed = true;
+      } else if (entry.existed) {
+        ::platon_set_state(entry.key.data(), entry.key_size, nullptr, 0);
+        entry.existed = false;
+      } else {
+        continue;
+      }
+      writes++;
+    }
+    DEBUG("state cache flush, writes:", writes, "keys:", size_);
+  }
+
+ private:
+  struct Entry {
+    std::array<byte, kMaxKeySize> key;
+    uint8_t key_size = 0;
+    bool used = false;
+    bool loaded = false;   // value was read from the state
+    bool existed = false;  // key exists in the state
+    bool present = false;  // key exists after the buffered writes
+    bool dirty = false;
+    bytes value;
+  };
+
+  static constexpr size_t kInitialCapacity = 16;
+
+  Entry &Load(const bytesConstRef &key) {
+    Entry &entry = Find(key);
+    if (!entry.loaded) {
+      size_t len = ::platon_get_state_length(key.data(), key.size());
+      entry.existed = len != 0;
+      entry.present = entry.existed;
+      entry.value.resize(len);
+      if (len != 0) {
+        ::platon_get_state(key.data(), key.size(), entry.value.data(), len);
+      }
+      entry.loaded = true;
+    }
+    return entry;
+  }
+
+  // A key written without being read is assumed to exist, so that erasing it
+  // always reaches the state
+  Entry &Touch(const bytesConstRef &key) {
+    Entry &entry = Find(key);
+    if (!entry.loaded) {
+      entry.existed = true;
+      entry.loaded = true;
+    }
+    return entry;
+  }
+
+  Entry &Find(const bytesConstRef &key) {
+    privacy_assert(key.size() >= sizeof(uint32_t) && key.size() <= kMaxKeySize,
+                   "illegal state cache key");
+    size_t i = Probe(key);
+    if (entries_[i].used) return entries_[i];
+
+    // Only a new key can push the load factor over one half
+    if ((size_ + 1) * 2 > entries_.size()) {
+      Grow();
+      i = Probe(key);
+    }
+    Entry &entry = entries_[i];
+    entry.used = true;
+    entry.key_size = static_cast<uint8_t>(key.size());
+    memcpy(entry.key.data(), key.data(), key.size());
+    size_++;
+    return entry;
+  }
+
+  // Slot of the key, or the free slot it would be inserted at
+  size_t Probe(const bytesConstRef &key) {
+    size_t mask = entries_.size() - 1;
+    for (size_t i = Slot(key.data(), key.size());; i = (i + 1) & mask) {
+      const Entry &entry = entries_[i];
+      if (!entry.used) return i;
+      if (entry.key_size == key.size() &&
+          memcmp(entry.key.data(), key.data(), key.size()) == 0) {
+        return i;
+      }
+    }
+  }
+
+  void Grow() {
+    std::vector<Entry> entries(entries_.size() * 2);
+    entries.swap(entries_);
+    size_t mask = entries_.size() - 1;
+    for (auto &entry : entries) {
+      if (!entry.used) continue;
+      size_t i = Slot(entry.key.data(), entry.key_size);
+      while (entries_[i].used) i = (i + 1) & mask;
+      entries_[i] = std::move(entry);
+    }
+  }
+
+  size_t Slot(const byte *key, size_t size) {
+    uint32_t bits = 0;
+    memcpy(&bits, key + size - sizeof(bits), sizeof(bits));
+    return bits & (entries_.size() - 1);
+  }
+
+  std::vector<Entry> entries_;
+  size_t size_ = 0;
+};
+
+}  // namespace privacy
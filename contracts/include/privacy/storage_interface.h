@@ -3,6 +3,42 @@
 #include <platon/platon.h>
 #include <privacy/utxo.h>
 namespace privacy {
+
+/**
+ * @brief Optional storage behaviours, selected when the registry is created.
+ */
+enum StorageOption : uint32_t {
+  kDigestOwner = 1 << 0,  // Only the sha3 digest of the note owner is stored
+  kOwnerIndex = 1 << 1,   // Live notes are indexed by owner
+  kLazyMigrate = 1 << 2,  // Migrate leaves the notes in the old storage
+  kNoteExport = 1 << 3,   // Live notes can be enumerated by ExportNotes
+  kSpentMarker = 1 << 4,  // Spent notes leave a marker that blocks re-creation
+  kNoteTree = 1 << 5,     // Created notes are accumulated in a Merkle tree
+};
+
+/**
+ * @brief One page of live notes returned by ExportNotes
+ */
+struct NoteExport {
+  std::vector<NoteStatus> notes;
+  platon::h256 cursor;  // The first note of the next page, zero at the end
+  uint64_t version;     // State version the page was read at
+  PLATON_SERIALIZE(NoteExport, (notes)(cursor)(version))
+};
+
+/**
+ * @brief Counters of a storage contract
+ */
+struct StorageStats {
+  uint64_t live_notes = 0;       // Notes kept in this storage
+  uint64_t created_notes = 0;    // Notes ever created
+  uint64_t destroyed_notes = 0;  // Notes ever spent
+  uint64_t state_bytes = 0;      // Bytes of note records and approvals
+  uint64_t approvals = 0;        // Live approvals
+  PLATON_SERIALIZE(StorageStats, (live_notes)(created_notes)(destroyed_notes)(
+                                     state_bytes)(approvals))
+};
+
 class StorageInterface {
   /**
    * @brief Create a Registry object
@@ -10,6 +46,15 @@ class StorageInterface {
    */
   virtual void CreateRegistry(bool can_mint_burn) = 0;
 
+  /**
+   * @brief Create a Registry object with optional storage behaviours
+   * @param  can_mint_burn  Whether to allow minting and destruction operations
+   * @param  options  StorageOption flags, unsupported flags trigger the revert
+   * operation
+   */
+  virtual void CreateRegistryWithOptions(bool can_mint_burn,
+                                         uint32_t options) = 0;
+
   /**
    * @brief Query Note information
    *
@@ -18,6 +63,16 @@ class StorageInterface {
    */
   virtual NoteStatus GetNote(const platon::h256 &note_hash) = 0;
 
+  /**
+   * @brief Query the information of several notes
+   *
+   * @param note_hashes hash values of notes
+   * @return One NoteStatus for each hash in the same order, a note that does
+   * not exist is returned with a zero hash instead of triggering revert
+   */
+  virtual std::vector<NoteStatus> GetNotes(
+      const std::vector<platon::h256> &note_hashes) = 0;
+
   /**
    * @brief Store approve information.
    * @param  outputs  approve information
@@ -40,6 +95,16 @@ class StorageInterface {
    */
   virtual void UpdateNotes(const platon::bytesConstRef &outputs) = 0;
 
+  /**
+   * @brief Update storage with the results of several transfers in one call.
+   * The results are applied in order, so an output created by an earlier
+   * transfer may be spent by a later one, but a note can not be spent twice or
+   * created twice within the batch.
+   *
+   * @param proof_results RLP list of serialized transfer results
+   */
+  virtual void UpdateNotesBatch(const platon::bytesConstRef &proof_results) = 0;
+
   /**
    * @brief Store coin information
    * @param  outputs  Serialized byte stream of coin information
@@ -61,6 +126,16 @@ class StorageInterface {
    * @return Contract address after upgrade
    */
   virtual Address Migrate(const Address &address) = 0;
+
+  /**
+   * @brief Initialize a storage created by a lazy migration, the caller is
+   * recorded as the predecessor storage and notes missing locally are looked
+   * up there.
+   *
+   * @param can_mint_burn Whether to allow minting and destruction operations
+   * @param options StorageOption flags of the predecessor storage
+   */
+  virtual void Inherit(bool can_mint_burn, uint32_t options) = 0;
 };
 
 }  // namespace privacy
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+#include "privacy/storage_proxy.hpp"
+#include "privacy/utxo.h"
+
+namespace privacy {
+
+/*
+ * Storage that a kLazyMigrate upgrade left the notes in. The predecessor is
+ * retired and only serves reads, notes are copied forward or marked as spent
+ * in the successor the first time they are touched.
+ *
+ * predecessor: | "predecessor"(8) | -> | address(20) |
+ */
+class StoragePredecessor {
+ public:
+  bool Exists() {
+    Load();
+    return address_ != Address();
+  }
+
+  void Set(const Address &address) {
+    ::platon_set_state((const byte *)&kPredecessor, sizeof(kPredecessor),
+                       address.data(), address.size);
+    address_ = address;
+    loaded_ = true;
+  }
+
+  /**
+   * @brief Look several notes up in the predecessor
+   *
+   * @param hashes hash values of notes
+   * @return One NoteStatus for each hash, with a zero hash when the note does
+   * not exist
+   */
+  std::vector<NoteStatus> FindNotes(const std::vector<h256> &hashes) {
+    privacy_assert(Exists(), "no predecessor storage");
+    StorageProxy storage(address_);
+    std::vector<NoteStatus> statuses = storage.GetNotes(hashes);
+    privacy_assert(statuses.size() == hashes.size(),
+                   "predecessor storage result mismatch");
+    return statuses;
+  }
+
+  bool FindNote(const h256 &hash, NoteStatus &status) {
+    std::vector<NoteStatus> statuses = FindNotes(std::vector<h256>{hash});
+    status = std::move(statuses[0]);
+    return status.hash != h256();
+  }
+
+  /**
+   * @brief Get a page of the live notes of the predecessor, which must be in
+   * kNoteExport mode. The predecessor is retired, so the pages never change.
+   *
+   * @param cursor The first note of the page, zero to start from the first
+   * note
+   * @param limit Maximum number of notes in the page
+   * @return Notes of the page and the cursor of the next page
+   */
+  NoteExport ExportNotes(const h256 &cursor, uint32_t limit) {
+    privacy_assert(Exists(), "no predecessor storage");
+    StorageProxy storage(address_);
+    return storage.ExportNotes(cursor, limit);
+  }
+
+  bytesConstRef GetApproval(const h256 &hash) {
+    privacy_assert(Exists(), "no predecessor storage");
+    StorageProxy storage(address_);
+    return storage.GetApproval(hash);
+  }
+
+ private:
+  void Load() {
+    if (loaded_) return;
+    if (::platon_get_state_length((const byte *)&kPredecessor,
+                                  sizeof(kPredecessor)) == address_.size) {
+      ::platon_get_state((const byte *)&kPredecessor, sizeof(kPredecessor),
+                         address_.data(), address_.size);
+    }
+    loaded_ = true;
+  }
+
+  const uint64_t kPredecessor = uint64_t(Name::Raw("predecessor"_n));
+  Address address_;
+  bool loaded_ = false;
+};
+
+}  // namespace privacy
@@ -1,5 +1,6 @@
 #pragma once
 #include "privacy/contract_proxy.h"
+#include "privacy/storage_interface.h"
 #include "privacy/utxo.h"
 namespace privacy {
 class StorageProxy : public ContractProxy {
@@ -8,9 +9,14 @@ class StorageProxy : public ContractProxy {
   explicit StorageProxy(const Address &addr) : ContractProxy(addr) {}
 
   PROXY_INTERFACE_VOID(CreateRegistry, bool)
+  PROXY_INTERFACE_VOID(CreateRegistryWithOptions, bool, uint32_t)
   PROXY_INTERFACE(GetNote, NoteStatus, const h256 &)
+  PROXY_INTERFACE(GetNotes, std::vector<NoteStatus>,
+                  const std::vector<h256> &)
+  PROXY_INTERFACE(ExportNotes, NoteExport, const h256 &, uint32_t)
 
   PROXY_INTERFACE_VOID(UpdateNotes, const bytesConstRef &)
+  PROXY_INTERFACE_VOID(UpdateNotesBatch, const bytesConstRef &)
   PROXY_INTERFACE(Approve, bytesConstRef, const bytesConstRef &)
 
   PROXY_INTERFACE(GetApproval, bytesConstRef, const h256 &)
@@ -19,6 +25,7 @@ class StorageProxy : public ContractProxy {
   PROXY_INTERFACE_VOID(Burn, const bytesConstRef &)
 
   PROXY_INTERFACE(Migrate, Address, const Address &)
+  PROXY_INTERFACE_VOID(Inherit, bool, uint32_t)
 };
 
 }  // namespace privacy
\ No newline at end of file
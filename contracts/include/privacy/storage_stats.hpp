@@ -0,0 +1,87 @@
+#pragma once
+
+#include <platon/platon.h>
+#include "privacy/common.hpp"
+#include "privacy/storage_interface.h"
+
+namespace privacy {
+
+/*
+ * StorageStats kept under one state key, loaded on first use and written back
+ * by Flush when changed. Counters start from the first action of a storage
+ * version that keeps them and never go below zero.
+ *
+ * stats: | "stats"(8) | -> | live(8) | created(8) | destroyed(8) | bytes(8) |
+ *                           | approvals(8) |
+ */
+class StorageCounters {
+ public:
+  const StorageStats &Get() {
+    Load();
+    return stats_;
+  }
+
+  void NoteCreated() { Update().created_notes++; }
+
+  void NoteDestroyed() { Update().destroyed_notes++; }
+
+  void NoteAdded() { Update().live_notes++; }
+
+  void NoteRemoved() { Decrease(Update().live_notes, 1); }
+
+  void ApprovalAdded() { Update().approvals++; }
+
+  void ApprovalRemoved() { Decrease(Update().approvals, 1); }
+
+  // A value of old_size bytes is replaced by one of new_size bytes
+  void Resize(size_t old_size, size_t new_size) {
+    StorageStats &stats = Update();
+    if (new_size >= old_size) {
+      stats.state_bytes += new_size - old_size;
+    } else {
+      Decrease(stats.state_bytes, old_size - new_size);
+    }
+  }
+
+  void Flush() {
+    if (!dirty_) return;
+    std::array<uint64_t, 5> value = {stats_.live_notes, stats_.created_notes,
+                                     stats_.destroyed_notes, stats_.state_bytes,
+                                     stats_.approvals};
+    ::platon_set_state((const byte *)&kStats, sizeof(kStats),
+                       (const byte *)value.data(),
+                       value.size() * sizeof(uint64_t));
+    dirty_ = false;
+  }
+
+ private:
+  void Load() {
+    if (loaded_) return;
+    std::array<uint64_t, 5> value = {};
+    ::platon_get_state((const byte *)&kStats, sizeof(kStats),
+                       (byte *)value.data(), value.size() * sizeof(uint64_t));
+    stats_.live_notes = value[0];
+    stats_.created_notes = value[1];
+    stats_.destroyed_notes = value[2];
+    stats_.state_bytes = value[3];
+    stats_.approvals = value[4];
+    loaded_ = true;
+  }
+
+  StorageStats &Update() {
+    Load();
+    dirty_ = true;
+    return stats_;
+  }
+
+  void Decrease(uint64_t &counter, uint64_t value) {
+    counter = counter > value ? counter - value : 0;
+  }
+
+  const uint64_t kStats = uint64_t(Name::Raw("stats"_n));
+  StorageStats stats_;
+  bool loaded_ = false;
+  bool dirty_ = false;
+};
+
+}  // namespace privacy
@@ -60,6 +60,28 @@ class ValidatorInterface {
   virtual platon::bytesConstRef ValidateProof(
       const platon::bytesConstRef& proof) = 0;
 
+  /**
+   * @brief Verify a proof like ValidateProof without emitting the per-output
+   * CreateNoteDetailEvent, for tokens in compact event mode
+   *
+   * @param proof Proof byte stream
+   * @return Return a serialized byte stream of authentication information
+   */
+  virtual platon::bytesConstRef ValidateCompactProof(
+      const platon::bytesConstRef& proof) = 0;
+
+  /**
+   * @brief Verify several proofs in one call, the proofs are validated in
+   * order and the call fails as a whole if any of them is illegal, the revert
+   * log carries the batch index of the offending proof
+   *
+   * @param proofs Proof byte streams
+   * @return Serialized authentication information of every proof, in the same
+   * order
+   */
+  virtual std::vector<platon::bytesConstRef> ValidateProofs(
+      const std::vector<platon::bytesConstRef>& proofs) = 0;
+
   /**
    * @brief Verify the legality of the signature
    *
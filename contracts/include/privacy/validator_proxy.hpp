@@ -11,6 +11,10 @@ class ValidatorProxy : public ContractProxy {
  public:
   PROXY_INTERFACE(ValidateProof, platon::bytesConstRef,
                   const platon::bytesConstRef &)
+  PROXY_INTERFACE(ValidateCompactProof, platon::bytesConstRef,
+                  const platon::bytesConstRef &)
+  PROXY_INTERFACE(ValidateProofs, std::vector<platon::bytesConstRef>,
+                  const std::vector<platon::bytesConstRef> &)
   PROXY_INTERFACE(ValidateSignature, bool, const platon::bytes &,
                   const platon::h256 &, const platon::bytesConstRef &)
   PROXY_INTERFACE(SupportProof, bool, uint32_t)
@@ -26,6 +26,26 @@ class BaseConfidentialToken : public ConfidentialTokenInterface {
                     const Address &registry_address, uint32_t validator_version,
                     uint32_t storage_version, u128 scaling_factor,
                     const Address &token_address) {
+    init(name, symbol, registry_address, validator_version, storage_version,
+         scaling_factor, token_address, RegistryOptions());
+  }
+
+  /**
+   * @brief Token deployment initialization interface with optional registry
+   * behaviours
+   * @param  name             token name
+   * @param  symbol           token symbol
+   * @param  registry_address Registered contract address
+   * @param  validator_version validator contarct version
+   * @param  storage_version  storage contract version
+   * @param  scaling_factor   Scaling factor
+   * @param  token_address    arc20 token contract address
+   * @param  options          Optional behaviours of the acl registration
+   */
+  void init(const std::string &name, const std::string &symbol,
+            const Address &registry_address, uint32_t validator_version,
+            uint32_t storage_version, u128 scaling_factor,
+            const Address &token_address, const RegistryOptions &options) {
     privacy_assert(!name.empty(), "token name is empty");
     privacy_assert(!symbol.empty(), "token symbol is empty");
     SetName(name);
@@ -40,9 +60,18 @@ class BaseConfidentialToken : public ConfidentialTokenInterface {
 
     privacy_assert(acl != Address(), "invalid acl address");
 
+    // tokens without options keep registering through CreateRegistry, so they
+    // still work with an acl that predates CreateRegistryWithOptions
     AclProxy ap(acl);
-    ap.CreateRegistry(validator_version, storage_version, scaling_factor,
-                      token_address, true);
+    if (options.storage_options == 0 && options.storage_shards == 0 &&
+        !options.shared_validator) {
+      ap.CreateRegistry(validator_version, storage_version, scaling_factor,
+                        token_address, true);
+    } else {
+      ap.CreateRegistryWithOptions(validator_version, storage_version,
+                                   scaling_factor, token_address, true,
+                                   options);
+    }
   }
 
   /**
@@ -67,8 +96,12 @@ class BaseConfidentialToken : public ConfidentialTokenInterface {
 
     DEBUG("validator success");
 
-    EmitCreateNotes(outputs);
-    EmitDestroyNotes(inputs);
+    if (CompactEvents()) {
+      EmitNoteChanges(outputs, inputs);
+    } else {
+      EmitCreateNotes(outputs);
+      EmitDestroyNotes(inputs);
+    }
     return true;
   }
 
@@ -102,6 +135,20 @@ class BaseConfidentialToken : public ConfidentialTokenInterface {
     return ap.GetApproval(note_hash);
   }
 
+  /**
+   * @brief Get the information of several notes
+   *
+   * @param note_hashes hash values of notes
+   * @return One NoteStatus for each hash in the same order, a note that does
+   * not exist is returned with a zero hash
+   */
+  CONST std::vector<NoteStatus> GetNotes(
+      const std::vector<h256> &note_hashes) {
+    Address acl = GetAcl();
+    AclProxy ap(acl);
+    return ap.GetNotes(note_hashes);
+  }
+
   /**
    * @brief Get the acl contract address
    *
@@ -232,6 +279,47 @@ class BaseConfidentialToken : public ConfidentialTokenInterface {
     return ap.UpdateStorage(version);
   }
 
+  /**
+   * @brief Switch the note events of the token. In compact mode a transaction
+   * emits a single NoteChangeEvent carrying all the created and destroyed
+   * notes, instead of a CreateNoteEvent and a MetaDataEvent per output and a
+   * DestroyNoteEvent per input, and the validator emits no
+   * CreateNoteDetailEvent per output.
+   *
+   * NoteChangeEvent has no owner topic, a wallet finds its notes by
+   * filtering the NoteChangeEvent logs of the token and matching the owner
+   * of every created note, the value and random of a note are read from the
+   * proof in the input of the transaction that emitted the event.
+   *
+   * @param compact Whether to emit compact events
+   * @return Successful true, false trigger revert operation
+   */
+  ACTION bool SetCompactEvents(bool compact) {
+    privacy_assert(GetOwner() == platon_caller(), "illegal update owner");
+    Address acl = GetAcl();
+    AclProxy ap(acl);
+    ap.SetCompactEvents(compact);
+    byte value = static_cast<byte>(compact);
+    ::platon_set_state((const byte *)&kCompactEventsKey,
+                       sizeof(kCompactEventsKey), &value, sizeof(value));
+    return true;
+  }
+
+  /**
+   * @brief Whether the token emits compact note events
+   *
+   * @return Compact mode returns true
+   */
+  CONST bool CompactEvents() {
+    byte value = 0;
+    if (::platon_get_state_length((const byte *)&kCompactEventsKey,
+                                  sizeof(kCompactEventsKey)) == sizeof(value)) {
+      ::platon_get_state((const byte *)&kCompactEventsKey,
+                         sizeof(kCompactEventsKey), &value, sizeof(value));
+    }
+    return value != 0;
+  }
+
   /**
    * @brief Determine whether the plug-in supports a certain version certificate
    *
@@ -290,18 +378,31 @@ class BaseConfidentialToken : public ConfidentialTokenInterface {
     }
   }
 
+  // Spent notes are identified by their hash alone, their owner is known from
+  // the event that created them
+  void EmitNoteChanges(const OutputNotes &outputs, const InputNotes &inputs) {
+    std::vector<h256> destroyed;
+    destroyed.reserve(inputs.size());
+    for (const InputNote &note : inputs) destroyed.push_back(note.hash);
+    PLATON_EMIT_EVENT0(NoteChangeEvent, outputs, destroyed);
+  }
+
   PLATON_EVENT1(ApproveEvent, const h256 &, const bytesConstRef &);
   PLATON_EVENT2(CreateNoteEvent, const bytesConstRef &, const h256 &,
                 const bytesConstRef &);
   PLATON_EVENT2(DestroyNoteEvent, const bytesConstRef &, const h256 &,
                 const bytesConstRef &);
   PLATON_EVENT1(MetaDataEvent, const h256 &, const bytesConstRef &);
+  // created notes (owner, hash, meta data), destroyed note hashes
+  PLATON_EVENT0(NoteChangeEvent, const OutputNotes &,
+                const std::vector<h256> &);
 
  private:
   const uint64_t kRegistryKey = uint64_t(Name::Raw("registry"_n));
   const uint64_t kOwnerKey = uint64_t(Name::Raw("owner"_n));
   const uint64_t kNameKey = uint64_t(Name::Raw("name"_n));
   const uint64_t kSymbolKey = uint64_t(Name::Raw("symbol"_n));
+  const uint64_t kCompactEventsKey = uint64_t(Name::Raw("compact_ev"_n));
 };
 
 class MintBurnConfidentialToken : public BaseConfidentialToken,
@@ -324,7 +425,11 @@ class MintBurnConfidentialToken : public BaseConfidentialToken,
     MintResult result;
     fetch(RLP(outputs), result);
     PLATON_EMIT_EVENT0(MintEvent, result.new_mint_hash, result.total_mint);
-    EmitCreateNotes(result.outputs);
+    if (CompactEvents()) {
+      EmitNoteChanges(result.outputs, InputNotes());
+    } else {
+      EmitCreateNotes(result.outputs);
+    }
     return true;
   }
 
@@ -344,7 +449,11 @@ class MintBurnConfidentialToken : public BaseConfidentialToken,
     BurnResult result;
     fetch(RLP(outputs), result);
     PLATON_EMIT_EVENT0(BurnEvent, result.new_burn_hash, result.total_burn);
-    EmitDestroyNotes(result.inputs);
+    if (CompactEvents()) {
+      EmitNoteChanges(OutputNotes(), result.inputs);
+    } else {
+      EmitDestroyNotes(result.inputs);
+    }
     return true;
   }
 
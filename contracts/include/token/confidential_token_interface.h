@@ -76,6 +76,16 @@ class ConfidentialTokenInterface {
    */
   virtual platon::bytesConstRef GetApproval(const platon::h256 &note_hash) = 0;
 
+  /**
+   * @brief Get the information of several notes
+   *
+   * @param note_hashes hash values of notes
+   * @return One NoteStatus for each hash in the same order, a note that does
+   * not exist is returned with a zero hash
+   */
+  virtual std::vector<privacy::NoteStatus> GetNotes(
+      const std::vector<platon::h256> &note_hashes) = 0;
+
   /**
    * @brief Get the acl contract address
    *
@@ -83,15 +83,43 @@ class Acl : public ValidatorManager,
                              uint32_t storage_version, u128 scaling_factor,
                              const Address &token_address,
                              bool can_mint_burn) override {
+    return CreateRegistryWithOptions(validator_version, storage_version,
+                                     scaling_factor, token_address,
+                                     can_mint_burn, RegistryOptions());
+  }
+
+  /**
+   * @brief Privacy contract registration interface with optional behaviours
+   *
+   *
+   * @param validator_version validataor contract version number
+   * @param storage_version storage contract version number
+   * @param scaling_factor Scaling factor
+   * @param token_address token address
+   * @param can_mint_burn Whether to support minting and destruction
+   * @param options Optional behaviours of the registration, with more than one
+   * storage shard the notes are spread over several storage contracts by note
+   * hash, with shared_validator the token uses the validator instance shared by
+   * every such token of the version instead of a clone of its own
+   * @return Success returns true, failure triggers revert
+   */
+  ACTION bool CreateRegistryWithOptions(
+      uint32_t validator_version, uint32_t storage_version,
+      u128 scaling_factor, const Address &token_address, bool can_mint_burn,
+      const RegistryOptions &options) override {
     Address sender = platon_caller();
     privacy_assert(platon_get_state_length(sender.data(), sender.size) == 0,
                    "had registered");
+    uint8_t shards = options.storage_shards == 0 ? 1 : options.storage_shards;
+    privacy_assert(shards <= kMaxStorageShards, "too many storage shards");
 
     TokenRegistry registry =
         TokenRegistry{token_address,   scaling_factor, validator_version,
                       storage_version, can_mint_burn,  0};
 
-    Address validator = ValidatorManager::Deploy(validator_version);
+    Address validator = options.shared_validator
+                            ? SharedValidator(validator_version)
+                            : ValidatorManager::Deploy(validator_version);
     Address storage = StorageManager::Deploy(storage_version);
 
     DEBUG("sender", sender.toString(), "registry storage", storage.toString(),
@@ -99,7 +127,16 @@ class Acl : public ValidatorManager,
 
     ValidatorAdminProxy vp(sender, validator);
     StorageAdminProxy sp(sender, storage);
-    sp.CreateRegistry(can_mint_burn);
+    sp.CreateRegistryWithOptions(can_mint_burn, options.storage_options);
+    for (uint8_t shard = 1; shard < shards; shard++) {
+      StorageAdminProxy shard_proxy(
+          sender, StorageManager::Deploy(storage_version), shard);
+      shard_proxy.CreateRegistryWithOptions(can_mint_burn,
+                                            options.storage_options);
+    }
+    if (shards > 1) {
+      SetStorageShards(sender, shards);
+    }
 
     set_state<TokenRegistry, 60>(sender.data(), sender.size, registry);
 
@@ -115,13 +152,32 @@ class Acl : public ValidatorManager,
    * @return The result of the transfer
    */
   ACTION virtual bytesConstRef Transfer(const bytesConstRef &proof) override {
-    bytesConstRef outputs = ValidateProof(proof);
+    bytesConstRef outputs = ValidateNotes(platon_caller(), proof);
 
     UpdateNotes(outputs);
 
     return outputs;
   }
 
+  /**
+   * @brief Switch the caller token to compact event mode. The notes of the
+   * token are then verified by ValidateCompactProof, which leaves out the
+   * CreateNoteDetailEvent of every output, the validators of the token must
+   * provide it.
+   *
+   * @param compact Whether the token emits compact events
+   * @return Success returns true, failure triggers revert
+   */
+  ACTION bool SetCompactEvents(bool compact) override {
+    Address sender = platon_caller();
+    privacy_assert(platon_get_state_length(sender.data(), sender.size) != 0,
+                   "token is not registered");
+    std::array<byte, 28> key = CompactEventsKey(sender);
+    byte value = static_cast<byte>(compact);
+    platon_set_state(key.data(), key.size(), &value, sizeof(value));
+    return true;
+  }
+
   /**
    * @brief Authorize other users to spend notes.
    *
@@ -136,7 +192,10 @@ class Acl : public ValidatorManager,
     ValidatorAdminProxy validator(sender);
     auto outputs = validator.ValidateProof(proof);
 
-    StorageAdminProxy storage(sender);
+    ApproveResult result;
+    fetch(RLP(outputs), result);
+    StorageAdminProxy storage(sender,
+                              ShardOf(result.note_hash, StorageShards(sender)));
     storage.Approve(outputs);
     DEBUG("storage approve");
     return outputs;
@@ -152,7 +211,8 @@ class Acl : public ValidatorManager,
   CONST bytesConstRef GetApproval(const h256 &note_hash) override {
     DEBUG("get approval", note_hash.toString());
     Address sender = platon_caller();
-    StorageAdminProxy storage(sender);
+    StorageAdminProxy storage(sender,
+                              ShardOf(note_hash, StorageShards(sender)));
     return storage.GetApproval(note_hash);
   }
 
@@ -169,8 +229,7 @@ class Acl : public ValidatorManager,
 
     privacy_assert(registry.can_mint_burn, "this asset is not mintable");
 
-    ValidatorAdminProxy validator(sender);
-    auto outputs = validator.ValidateProof(proof);
+    auto outputs = ValidateNotes(sender, proof);
 
     MintResult result;
     RLP rlp = RLP(outputs);
@@ -187,8 +246,23 @@ class Acl : public ValidatorManager,
     registry.total_supply = res.first;
     set_state<TokenRegistry, 60>(sender.data(), sender.size, registry);
 
-    StorageAdminProxy storage(sender);
-    storage.Mint(outputs);
+    uint8_t shards = StorageShards(sender);
+    if (shards == 1) {
+      StorageAdminProxy storage(sender);
+      storage.Mint(outputs);
+      return outputs;
+    }
+
+    fetch(rlp[3], result.outputs);
+    fetch(rlp[4], result.sender);
+    std::vector<OutputNotes> shard_outputs = SplitNotes(result.outputs, shards);
+    for (uint8_t shard = 0; shard < shards; shard++) {
+      if (shard_outputs[shard].empty()) continue;
+      StorageAdminProxy storage(sender, shard);
+      storage.Mint(SerializeResultRef(
+          MintResult{result.old_mint_hash, result.new_mint_hash,
+                     result.total_mint, shard_outputs[shard], result.sender}));
+    }
 
     return outputs;
   }
@@ -206,8 +280,7 @@ class Acl : public ValidatorManager,
 
     privacy_assert(registry.can_mint_burn, "this asset is not burnable");
 
-    ValidatorAdminProxy validator(sender);
-    auto outputs = validator.ValidateProof(proof);
+    auto outputs = ValidateNotes(sender, proof);
 
     BurnResult result;
     RLP rlp = RLP(outputs);
@@ -224,8 +297,23 @@ class Acl : public ValidatorManager,
     registry.total_supply = res.first;
     set_state<TokenRegistry, 60>(sender.data(), sender.size, registry);
 
-    StorageAdminProxy storage(sender);
-    storage.Burn(outputs);
+    uint8_t shards = StorageShards(sender);
+    if (shards == 1) {
+      StorageAdminProxy storage(sender);
+      storage.Burn(outputs);
+      return outputs;
+    }
+
+    fetch(rlp[3], result.inputs);
+    fetch(rlp[4], result.sender);
+    std::vector<InputNotes> shard_inputs = SplitNotes(result.inputs, shards);
+    for (uint8_t shard = 0; shard < shards; shard++) {
+      if (shard_inputs[shard].empty()) continue;
+      StorageAdminProxy storage(sender, shard);
+      storage.Burn(SerializeResultRef(
+          BurnResult{result.old_burn_hash, result.new_burn_hash,
+                     result.total_burn, shard_inputs[shard], result.sender}));
+    }
 
     return outputs;
   }
@@ -249,6 +337,21 @@ class Acl : public ValidatorManager,
     return result;
   }
 
+  /**
+   * @brief verification interface for several proofs
+   *
+   * @param proofs proof information
+   * @return Verification result of every proof in the same order
+   */
+  CONST std::vector<bytesConstRef> ValidateProofs(
+      const std::vector<bytesConstRef> &proofs) override {
+    Address sender = platon_caller();
+
+    ValidatorAdminProxy validator(sender);
+    DEBUG("sender", sender.toString(), "proofs", proofs.size());
+    return validator.ValidateProofs(proofs);
+  }
+
   /**
    * @brief Verify the legality of the signature
    *
@@ -285,6 +388,24 @@ class Acl : public ValidatorManager,
     return registry;
   }
 
+  /**
+   * @brief Obtain the storage contracts of a privacy contract
+   *
+   * @param addr privacy contract address
+   * @return Storage contract addresses in shard order, the first one is the
+   * storage address of the registration information
+   */
+  CONST std::vector<Address> GetStorageShards(const Address &addr) override {
+    uint8_t shards = StorageShards(addr);
+    std::vector<Address> storages;
+    storages.reserve(shards);
+    for (uint8_t shard = 0; shard < shards; shard++) {
+      StorageAdminProxy storage(addr, shard);
+      storages.push_back(storage.GetProxy());
+    }
+    return storages;
+  }
+
   /**
    * @brief Obtain privacy contract registration information
    *
@@ -295,10 +416,49 @@ class Acl : public ValidatorManager,
     Address sender = platon_caller();
     TokenRegistry registry;
     get_state(sender.data(), sender.size, registry);
-    StorageAdminProxy storage(sender);
+    StorageAdminProxy storage(sender,
+                              ShardOf(note_hash, StorageShards(sender)));
     return storage.GetNote(note_hash);
   }
 
+  /**
+   * @brief Obtain the information of several notes
+   *
+   * @param note_hashes hash values of notes
+   * @return One NoteStatus for each hash in the same order, a note that does
+   * not exist is returned with a zero hash
+   */
+  CONST std::vector<NoteStatus> GetNotes(
+      const std::vector<h256> &note_hashes) override {
+    Address sender = platon_caller();
+    uint8_t shards = StorageShards(sender);
+    if (shards == 1) {
+      StorageAdminProxy storage(sender);
+      return storage.GetNotes(note_hashes);
+    }
+
+    std::vector<std::vector<size_t>> positions(shards);
+    for (size_t i = 0; i < note_hashes.size(); i++) {
+      positions[ShardOf(note_hashes[i], shards)].push_back(i);
+    }
+    std::vector<NoteStatus> statuses(note_hashes.size());
+    for (uint8_t shard = 0; shard < shards; shard++) {
+      if (positions[shard].empty()) continue;
+      std::vector<h256> hashes;
+      hashes.reserve(positions[shard].size());
+      for (size_t i : positions[shard]) hashes.push_back(note_hashes[i]);
+
+      StorageAdminProxy storage(sender, shard);
+      std::vector<NoteStatus> shard_statuses = storage.GetNotes(hashes);
+      privacy_assert(shard_statuses.size() == hashes.size(),
+                     "storage shard result mismatch");
+      for (size_t j = 0; j < hashes.size(); j++) {
+        statuses[positions[shard][j]] = std::move(shard_statuses[j]);
+      }
+    }
+    return statuses;
+  }
+
   /**
    * @brief Determine whether the verification contract supports a certain
    * version
@@ -312,6 +472,31 @@ class Acl : public ValidatorManager,
     return validator.SupportProof(version);
   }
 
+  /**
+   * @brief Users upgrade their validator contract, a token on a shared
+   * validator moves to the validator shared by the new version instead of
+   * migrating to a clone of its own
+   *
+   * @param version version number
+   * @return Return true on success, failure triggers revert
+   */
+  ACTION bool UpdateValidator(uint32_t version) override {
+    Address sender = platon_caller();
+    TokenRegistry registry;
+    get_state(sender.data(), sender.size, registry);
+
+    ValidatorAdminProxy validator(sender);
+    if (!HasSharedValidator(registry.validator_version) ||
+        validator.GetProxy() != SharedValidator(registry.validator_version)) {
+      return ValidatorManager::UpdateValidator(version);
+    }
+
+    validator.UpdateProxy(sender, SharedValidator(version));
+    registry.validator_version = version;
+    set_state<TokenRegistry, 60>(sender.data(), sender.size, registry);
+    return true;
+  }
+
   /**
    * @brief Upgrade acl contract
    * 1. Only contract administrators can upgrade contracts.
@@ -379,15 +564,20 @@ class Acl : public ValidatorManager,
   void UpdateNotes(const bytesConstRef &outputs) {
     Address sender = platon_caller();
 
-    StorageAdminProxy storage(sender);
-    storage.UpdateNotes(outputs);
-    DEBUG("storage update success");
-
     TransferResult result;
     RLP rlp = RLP(outputs);
     fetch(rlp[2], result.public_owner);
     fetch(rlp[3], result.public_value);
 
+    uint8_t shards = StorageShards(sender);
+    if (shards == 1) {
+      StorageAdminProxy storage(sender);
+      storage.UpdateNotes(outputs);
+    } else {
+      UpdateShardNotes(sender, shards, rlp, result);
+    }
+    DEBUG("storage update success");
+
     if (result.public_value != 0) {
       TokenRegistry registry;
       get_state(sender.data(), sender.size, registry);
@@ -429,21 +619,156 @@ class Acl : public ValidatorManager,
     }
   }
 
+ private:
+  /**
+   * @brief The validator instance shared by the tokens of a version. The
+   * validators keep no state, so one instance serves every token, it is
+   * deployed the first time the version is used.
+   *
+   * @param version validator contract version number
+   * @return Address of the shared validator
+   */
+  Address SharedValidator(uint32_t version) {
+    std::array<byte, 12> key = SharedValidatorKey(version);
+    Address validator;
+    if (platon_get_state_length(key.data(), key.size()) != 0) {
+      platon_get_state(key.data(), key.size(), validator.data(),
+                       validator.size);
+      return validator;
+    }
+
+    validator = ValidatorManager::Deploy(version);
+    platon_set_state(key.data(), key.size(), validator.data(), validator.size);
+    PLATON_EMIT_EVENT1(CreateSharedValidator, version, validator);
+    return validator;
+  }
+
+  bool HasSharedValidator(uint32_t version) {
+    std::array<byte, 12> key = SharedValidatorKey(version);
+    return platon_get_state_length(key.data(), key.size()) != 0;
+  }
+
+  std::array<byte, 12> SharedValidatorKey(uint32_t version) {
+    std::array<byte, 12> key;
+    memcpy(key.data(), (const byte *)&kSharedValidatorKey,
+           sizeof(kSharedValidatorKey));
+    memcpy(key.data() + sizeof(kSharedValidatorKey), &version,
+           sizeof(version));
+    return key;
+  }
+
+  // Verify the notes of a transfer, mint or burn, tokens in compact event
+  // mode get no detail event per output
+  bytesConstRef ValidateNotes(const Address &sender,
+                              const bytesConstRef &proof) {
+    ValidatorAdminProxy validator(sender);
+    if (CompactEvents(sender)) return validator.ValidateCompactProof(proof);
+    return validator.ValidateProof(proof);
+  }
+
+  bool CompactEvents(const Address &owner) {
+    std::array<byte, 28> key = CompactEventsKey(owner);
+    byte value = 0;
+    if (platon_get_state_length(key.data(), key.size()) == sizeof(value)) {
+      platon_get_state(key.data(), key.size(), &value, sizeof(value));
+    }
+    return value != 0;
+  }
+
+  std::array<byte, 28> CompactEventsKey(const Address &owner) {
+    std::array<byte, 28> key;
+    std::copy(owner.data(), owner.data() + owner.size, key.data());
+    memcpy(key.data() + owner.size, (const byte *)&kCompactEventsKey,
+           sizeof(kCompactEventsKey));
+    return key;
+  }
+
+  /**
+   * @brief Update the storage shards touched by a transfer, every shard only
+   * receives the notes it keeps
+   */
+  void UpdateShardNotes(const Address &sender, uint8_t shards, const RLP &rlp,
+                        TransferResult &result) {
+    fetch(rlp[0], result.inputs);
+    fetch(rlp[1], result.outputs);
+    fetch(rlp[4], result.sender);
+
+    std::vector<InputNotes> shard_inputs = SplitNotes(result.inputs, shards);
+    std::vector<OutputNotes> shard_outputs = SplitNotes(result.outputs, shards);
+    for (uint8_t shard = 0; shard < shards; shard++) {
+      if (shard_inputs[shard].empty() && shard_outputs[shard].empty()) continue;
+      StorageAdminProxy storage(sender, shard);
+      storage.UpdateNotes(SerializeResultRef(
+          TransferResult{shard_inputs[shard], shard_outputs[shard],
+                         result.public_owner, result.public_value,
+                         result.sender}));
+      DEBUG("storage shard update success:", shard);
+    }
+  }
+
+  template <typename Notes>
+  std::vector<Notes> SplitNotes(const Notes &notes, uint8_t shards) {
+    std::vector<Notes> shard_notes(shards);
+    for (auto &note : notes) {
+      shard_notes[ShardOf(note.hash, shards)].push_back(note);
+    }
+    return shard_notes;
+  }
+
+  // Shard of a note, notes are spread evenly by the first byte of the hash
+  uint8_t ShardOf(const h256 &hash, uint8_t shards) {
+    return static_cast<uint8_t>((uint32_t(hash.data()[0]) * shards) >> 8);
+  }
+
+  uint8_t StorageSlots(const Address &owner) override {
+    return StorageShards(owner);
+  }
+
+  uint8_t StorageShards(const Address &owner) {
+    std::array<byte, 28> key = StorageShardsKey(owner);
+    uint8_t shards = 1;
+    if (platon_get_state_length(key.data(), key.size()) != 0) {
+      platon_get_state(key.data(), key.size(), &shards, sizeof(shards));
+    }
+    return shards;
+  }
+
+  void SetStorageShards(const Address &owner, uint8_t shards) {
+    std::array<byte, 28> key = StorageShardsKey(owner);
+    platon_set_state(key.data(), key.size(), &shards, sizeof(shards));
+  }
+
+  std::array<byte, 28> StorageShardsKey(const Address &owner) {
+    std::array<byte, 28> key;
+    std::copy(owner.data(), owner.data() + owner.size, key.data());
+    memcpy(key.data() + owner.size, (const byte *)&kStorageShardsKey,
+           sizeof(kStorageShardsKey));
+    return key;
+  }
+
  private:
   PLATON_EVENT1(CreateRegistryNote, const Address &, const Address &,
                 const Address &, const Address &);
 
   PLATON_EVENT2(AclMigrateEvent, const Address &, const Address &);
 
+  PLATON_EVENT1(CreateSharedValidator, uint32_t, const Address &);
+
  private:
   const uint64_t kRegistryKey = uint64_t(Name::Raw("registry"_n));
   const uint64_t kTokenManagerKey = uint64_t(Name::Raw("tokenManager"_n));
+  const uint64_t kStorageShardsKey = uint64_t(Name::Raw("shards"_n));
+  const uint64_t kSharedValidatorKey = uint64_t(Name::Raw("sharedval"_n));
+  const uint64_t kCompactEventsKey = uint64_t(Name::Raw("compact_ev"_n));
+  static constexpr uint8_t kMaxStorageShards = 16;
 };
 
 PLATON_DISPATCH(
-    Acl, (init)(GetTokenManager)(CreateRegistry)(ValidateProof)(Approve)(
-             GetApproval)(Mint)(Burn)(GetRegistry)(Transfer)(GetNote)(
-             ValidateSignature)(SupportProof)(Migrate)(CreateValidator)(
-             UpdateValidatorVersion)(ValidatorLatest)(ValidatorLatestMinor)(
-             UpdateValidator)(CreateStorage)(UpdateStorageVersion)(
-             StorageLatest)(StorageLatestMinor)(UpdateStorage))
+    Acl, (init)(GetTokenManager)(CreateRegistry)(CreateRegistryWithOptions)(
+             ValidateProof)(ValidateProofs)(SetCompactEvents)(Approve)(
+             GetApproval)(Mint)(Burn)(GetRegistry)(GetStorageShards)(Transfer)(
+             GetNote)(GetNotes)(ValidateSignature)(SupportProof)(Migrate)(
+             CreateValidator)(UpdateValidatorVersion)(ValidatorLatest)(
+             ValidatorLatestMinor)(UpdateValidator)(CreateStorage)(
+             UpdateStorageVersion)(StorageLatest)(StorageLatestMinor)(
+             UpdateStorage))
\ No newline at end of file
@@ -1,8 +1,15 @@
 #include <platon/platon.h>
+#include <set>
 #include "platon/call.hpp"
 #include "privacy/common.hpp"
 #include "privacy/debug/gas/stack_helper.h"
+#include "privacy/note_list.hpp"
+#include "privacy/note_record.hpp"
+#include "privacy/note_tree.hpp"
+#include "privacy/state_cache.hpp"
 #include "privacy/storage_interface.h"
+#include "privacy/storage_predecessor.hpp"
+#include "privacy/storage_stats.hpp"
 #include "privacy/utxo.h"
 #include "privacy/validator_interface.hpp"
 #include "platon/escape_event.hpp"
@@ -16,10 +23,49 @@ class Storage : public StorageInterface, public Contract {
    * @param  can_mint_burn  Whether to allow minting and destruction operations
    */
   ACTION virtual void CreateRegistry(bool can_mint_burn) override {
+    CreateRegistryWithOptions(can_mint_burn, 0);
+  }
+
+  /**
+   * @brief Create a Registry object with optional storage behaviours
+   * @param  can_mint_burn  Whether to allow minting and destruction operations
+   * @param  options  StorageOption flags, kOwnerIndex keeps an index of live
+   * notes by owner for GetNotesByOwner, kNoteExport keeps a list of live notes
+   * for ExportNotes, kLazyMigrate leaves the notes in this storage when it is
+   * upgraded, kNoteTree accumulates the created notes in the Merkle tree of
+   * NoteRoot. kLazyMigrate can not be combined with kOwnerIndex, with
+   * kNoteExport a successor lists the inherited notes once DrainOldStorage has
+   * copied them forward.
+   */
+  ACTION virtual void CreateRegistryWithOptions(bool can_mint_burn,
+                                                uint32_t options) override {
+    privacy_assert(!Initialize(), "had initialized");
+    privacy_assert((options & ~kSupportedOptions) == 0,
+                   "unsupported storage option");
+    privacy_assert((options & (kOwnerIndex | kLazyMigrate)) !=
+                       (kOwnerIndex | kLazyMigrate),
+                   "owner index can not be migrated lazily");
+
+    SetInitialize(true);
+    SetMintBurn(can_mint_burn);
+    SetOptions(options);
+  }
+
+  /**
+   * @brief Initialize a storage created by a lazy migration, the caller is
+   * recorded as the predecessor storage
+   * @param  can_mint_burn  Whether to allow minting and destruction operations
+   * @param  options  StorageOption flags of the predecessor storage
+   */
+  ACTION virtual void Inherit(bool can_mint_burn, uint32_t options) override {
     privacy_assert(!Initialize(), "had initialized");
+    privacy_assert((options & ~kSupportedOptions) == 0,
+                   "unsupported storage option");
 
+    predecessor_.Set(platon_caller());
     SetInitialize(true);
     SetMintBurn(can_mint_burn);
+    SetOptions(options);
   }
 
   /**
@@ -35,6 +81,109 @@ class Storage : public StorageInterface, public Contract {
     return status;
   }
 
+  /**
+   * @brief Query the information of several notes
+   *
+   * @param hashes hash values of notes
+   * @return One NoteStatus for each hash in the same order, a note that does
+   * not exist is returned with a zero hash instead of triggering revert
+   */
+  CONST virtual std::vector<NoteStatus> GetNotes(
+      const std::vector<h256> &hashes) override {
+    privacy_assert(Initialize(), "uninitialized");
+    std::vector<NoteStatus> statuses(hashes.size());
+    std::vector<size_t> missing;
+    for (size_t i = 0; i < hashes.size(); i++) {
+      if (LookupNote(hashes[i], &statuses[i]) == NoteLookup::kMissing) {
+        missing.push_back(i);
+      }
+    }
+
+    if (!missing.empty() && predecessor_.Exists()) {
+      std::vector<h256> inherited;
+      inherited.reserve(missing.size());
+      for (size_t i : missing) inherited.push_back(hashes[i]);
+      std::vector<NoteStatus> found = predecessor_.FindNotes(inherited);
+      for (size_t j = 0; j < missing.size(); j++) {
+        statuses[missing[j]] = std::move(found[j]);
+      }
+    }
+    return statuses;
+  }
+
+  /**
+   * @brief Query the counters of the storage, they are kept from the storage
+   * version that introduced them on
+   *
+   * @return Live, created and spent notes, bytes of note state and live
+   * approvals
+   */
+  CONST StorageStats GetStats() {
+    privacy_assert(Initialize(), "uninitialized");
+    return counters_.Get();
+  }
+
+  /**
+   * @brief Root of the Merkle tree of all the notes created in this storage,
+   * only available in kNoteTree mode. Spent notes are not removed from the
+   * tree. Leaves are numbered from 0 in creation order and published by
+   * NoteTreeEvent, inclusion paths are built off chain from them.
+   *
+   * @return Merkle root
+   */
+  CONST h256 NoteRoot() {
+    privacy_assert(Initialize(), "uninitialized");
+    privacy_assert((Options() & kNoteTree) != 0, "note tree is disabled");
+    return NoteTree().Root();
+  }
+
+  /**
+   * @brief Enumerate the live notes, only available in kNoteExport mode. Notes
+   * are returned in creation order.
+   *
+   * The state version changes whenever notes are created or spent, pages read
+   * at the same version form a consistent snapshot, otherwise the notes
+   * changed in the meantime have to be caught up from the events.
+   *
+   * @param cursor The first note of the page, zero to start from the first
+   * note
+   * @param limit Maximum number of notes in the page
+   * @return Notes of the page, the cursor of the next page (zero after the
+   * last page) and the state version
+   */
+  CONST NoteExport ExportNotes(const h256 &cursor, uint32_t limit) {
+    privacy_assert(Initialize(), "uninitialized");
+    privacy_assert((Options() & kNoteExport) != 0, "note export is disabled");
+
+    NotePage page = LiveNotes().Page(cursor, limit);
+    NoteExport result;
+    result.notes.resize(page.notes.size());
+    for (size_t i = 0; i < page.notes.size(); i++) {
+      GetNoteStatus(page.notes[i], result.notes[i]);
+    }
+    result.cursor = page.cursor;
+    result.version = StateVersion();
+    return result;
+  }
+
+  /**
+   * @brief Query the live notes of an owner, only available in kOwnerIndex
+   * mode. Notes are returned in creation order.
+   *
+   * @param owner note owner
+   * @param cursor The first note of the page, zero to start from the first
+   * note
+   * @param limit Maximum number of notes in the page
+   * @return Note hashes of the page and the cursor of the next page, the cursor
+   * is zero after the last page
+   */
+  CONST NotePage GetNotesByOwner(const bytesConstRef &owner,
+                                 const h256 &cursor, uint32_t limit) {
+    privacy_assert(Initialize(), "uninitialized");
+    privacy_assert((Options() & kOwnerIndex) != 0, "owner index is disabled");
+    return OwnerIndex(owner).Page(cursor, limit);
+  }
+
   /**
    * @brief Update Note, if the Note corresponding to the inputs does not exist,
    * the revert operation will be triggered.
@@ -42,16 +191,39 @@ class Storage : public StorageInterface, public Contract {
    * @param proof_result Transfer result information
    */
   ACTION virtual void UpdateNotes(const bytesConstRef &proof_result) override {
-    privacy_assert(Initialize(), "uninitialized");
+    CheckWritable();
 
     TransferResult result;
-    RLP rlp(proof_result);
-    fetch(rlp[0], result.inputs);
-    fetch(rlp[1], result.outputs);
-    fetch(rlp[4], result.sender);
+    FetchTransferResult(RLP(proof_result), result);
 
     UpdateInputNotes(result.inputs);
     UpdateOutputNotes(result.outputs, result.sender);
+    FlushState();
+  }
+
+  /**
+   * @brief Update Note with the results of several transfers, the initialize
+   * state is read once for the whole batch.
+   *
+   * @param proof_results RLP list of serialized transfer results
+   */
+  ACTION virtual void UpdateNotesBatch(
+      const bytesConstRef &proof_results) override {
+    CheckWritable();
+
+    RLP rlp(proof_results);
+    std::set<h256> spent;
+    std::set<h256> created;
+    for (size_t i = 0; i < rlp.itemCount(); i++) {
+      TransferResult result;
+      FetchTransferResult(RLP(rlp[i].toBytesConstRef()), result);
+      CheckBatchCollision(result, spent, created);
+
+      UpdateInputNotes(result.inputs);
+      UpdateOutputNotes(result.outputs, result.sender);
+    }
+    FlushState();
+    DEBUG("update batch success, transfers:", rlp.itemCount());
   }
 
   /**
@@ -61,13 +233,18 @@ class Storage : public StorageInterface, public Contract {
    */
   ACTION virtual void Approve(const bytesConstRef &outputs) override {
     DEBUG("approve storage outputs", toHex(outputs));
-    privacy_assert(Initialize(), "uninitialized");
+    CheckWritable();
     ApproveResult result;
     fetch(RLP(outputs), result);
-    privacy_assert(HasNote(result.note_hash), "note is invalid");
+    privacy_assert(TouchNote(result.note_hash), "note is invalid");
+    MarkApproved(result.note_hash);
     std::array<byte, 40> key = GetApproveKey(result.note_hash);
-    platon_set_state(key.data(), key.size(), result.shared_sign.data(),
+    const bytes *old = cache_.Get(bytesConstRef(key.data(), key.size()));
+    if (old == nullptr) counters_.ApprovalAdded();
+    counters_.Resize(old == nullptr ? 0 : old->size(),
                      result.shared_sign.size());
+    cache_.Set(bytesConstRef(key.data(), key.size()), result.shared_sign);
+    FlushState();
     DEBUG("approve storage", result.note_hash.toString());
   }
 
@@ -82,6 +259,10 @@ class Storage : public StorageInterface, public Contract {
 
     std::array<byte, 40> key = GetApproveKey(note_hash);
     size_t length = platon_get_state_length(key.data(), key.size());
+    if (length == 0 && predecessor_.Exists() &&
+        LookupNote(note_hash, nullptr) != NoteLookup::kSpent) {
+      return predecessor_.GetApproval(note_hash);
+    }
     privacy_assert(length != 0, "invalid note hash");
     bytes &shared_secret = *new bytes();
     shared_secret.resize(length);
@@ -95,10 +276,12 @@ class Storage : public StorageInterface, public Contract {
    * @return ACTION
    */
   ACTION virtual void Mint(const bytesConstRef &outputs) override {
+    CheckWritable();
     privacy_assert(MintBurn(), "this asset is not mintable");
     MintResult result;
     fetch(RLP(outputs), result);
     UpdateOutputNotes(result.outputs, result.sender);
+    FlushState();
   }
 
   /**
@@ -107,19 +290,59 @@ class Storage : public StorageInterface, public Contract {
    * @return ACTION
    */
   ACTION virtual void Burn(const bytesConstRef &outputs) override {
+    CheckWritable();
     privacy_assert(MintBurn(), "this asset is not burnable");
     BurnResult result;
     fetch(RLP(outputs), result);
     UpdateInputNotes(result.inputs);
+    FlushState();
   }
 
   /**
-   * @brief Migration upgrade
+   * @brief Copy notes forward from the predecessor storage of a lazy
+   * migration, so that later reads and updates of these notes stay local.
+   * Every call continues the sweep of the predecessor notes where the previous
+   * one stopped, notes that are already local are skipped. Only available in
+   * kNoteExport mode, the notes of the predecessor are enumerated by its
+   * ExportNotes.
+   *
+   * @param limit Maximum number of predecessor notes to sweep, capped to
+   * kMaxDrainSize
+   * @return Whether the sweep has passed the last note of the predecessor
+   */
+  ACTION bool DrainOldStorage(uint32_t limit) {
+    CheckWritable();
+    privacy_assert(predecessor_.Exists(), "no predecessor storage");
+    privacy_assert((Options() & kNoteExport) != 0, "note export is disabled");
+    if (limit == 0 || limit > kMaxDrainSize) limit = kMaxDrainSize;
+
+    h256 cursor;
+    if (!DrainCursor(cursor)) return true;
+    NoteExport page = predecessor_.ExportNotes(cursor, limit);
+    size_t copied = 0;
+    for (auto &status : page.notes) {
+      if (LookupNote(status.hash, nullptr) != NoteLookup::kMissing) continue;
+      CopyForward(status);
+      copied++;
+    }
+    if (copied != 0) BumpStateVersion();
+    SetDrainCursor(page.cursor);
+    FlushState();
+    DEBUG("drain old storage, notes:", copied);
+    return page.cursor == h256();
+  }
+
+  /**
+   * @brief Migration upgrade, in kLazyMigrate mode the notes are left in this
+   * storage and read through by the new one
    *
    * @param address Template contract address
    * @return Contract address after upgrade
    */
   ACTION Address Migrate(const Address &address) override {
+    privacy_assert(InitializeStatus() != kRetired, "storage is retired");
+    if ((Options() & kLazyMigrate) != 0) return MigrateLazy(address);
+
     bytesConstRef init_rlp = escape::cross_call_args_ref("init");
     bytes value_bytes = value_to_bytes(u128(0));
     bytes gas_bytes = value_to_bytes(::platon_gas());
@@ -137,10 +360,41 @@ class Storage : public StorageInterface, public Contract {
 
  private:
   void DelApproval(const h256 &note_hash) {
-    privacy_assert(Initialize(), "uninitialized");
     std::array<byte, 40> key = GetApproveKey(note_hash);
-    byte del = 0;
-    platon_set_state(key.data(), key.size(), &del, 0);
+    const bytes *old = cache_.Get(bytesConstRef(key.data(), key.size()));
+    if (old == nullptr) return;
+    counters_.ApprovalRemoved();
+    counters_.Resize(old->size(), 0);
+    cache_.Erase(bytesConstRef(key.data(), key.size()));
+  }
+
+  // Flag the record of an approved note, so that the approval is cleared when
+  // the note is spent
+  void MarkApproved(const h256 &hash) {
+    bytes record;
+    ReadNoteRecord(hash, record);
+    if (record[0] != static_cast<byte>(NoteRecordFormat::kSenderId)) return;
+    record[0] = static_cast<byte>(NoteRecordFormat::kSenderIdApproved);
+    cache_.Set(NoteKey(hash), bytesConstRef(record.data(), record.size()));
+  }
+
+  void FetchTransferResult(const RLP &rlp, TransferResult &result) {
+    fetch(rlp[0], result.inputs);
+    fetch(rlp[1], result.outputs);
+    fetch(rlp[4], result.sender);
+  }
+
+  void CheckBatchCollision(const TransferResult &result, std::set<h256> &spent,
+                           std::set<h256> &created) {
+    for (auto &input : result.inputs) {
+      privacy_assert(spent.insert(input.hash).second, input.hash.toString(),
+                     "input note collides within batch");
+    }
+    for (auto &output : result.outputs) {
+      privacy_assert(
+          spent.count(output.hash) == 0 && created.insert(output.hash).second,
+          output.hash.toString(), "output note collides within batch");
+    }
   }
 
   std::array<byte, 40> GetApproveKey(const h256 &note_hash) {
@@ -153,74 +407,279 @@ class Storage : public StorageInterface, public Contract {
     return key;
   }
 
-  bool HasNote(const h256 &hash) {
-    size_t len = ::platon_get_state_length(hash.data(), hash.size);
-    DEBUG("has note len:", len);
-    return len != 0;
+  // The new storage starts empty and reads the notes through this one, which
+  // is retired and only serves reads from then on
+  Address MigrateLazy(const Address &address) {
+    auto res = escape::platon_create_contract(address, u128(0), ::platon_gas());
+    privacy_assert(res.second, "migrate failed");
+
+    StorageProxy successor(res.first);
+    successor.Inherit(MintBurn(), Options());
+    SetInitializeStatus(kRetired);
+    PLATON_EMIT_EVENT2(StorageMigrateEvent, platon_address(), res.first);
+    return res.first;
+  }
+
+  NoteLookup LookupNote(const h256 &hash, NoteStatus *status) {
+    const bytes *record = cache_.Get(NoteKey(hash));
+    if (record == nullptr) return NoteLookup::kMissing;
+    bytesConstRef ref(record->data(), record->size());
+    if (IsSpentRecord(ref)) return NoteLookup::kSpent;
+    if (status != nullptr) DecodeNoteRecord(hash, ref, senders_, *status);
+    return NoteLookup::kFound;
+  }
+
+  NoteLookup ReadNoteRecord(const h256 &hash, bytes &record) {
+    const bytes *cached = cache_.Get(NoteKey(hash));
+    if (cached == nullptr) return NoteLookup::kMissing;
+    record = *cached;
+    if (IsSpentRecord(bytesConstRef(record.data(), record.size()))) {
+      return NoteLookup::kSpent;
+    }
+    return NoteLookup::kFound;
+  }
+
+  bool FindNoteStatus(const h256 &hash, NoteStatus &status) {
+    NoteLookup lookup = LookupNote(hash, &status);
+    if (lookup == NoteLookup::kMissing && predecessor_.Exists()) {
+      return predecessor_.FindNote(hash, status);
+    }
+    return lookup == NoteLookup::kFound;
   }
 
   void GetNoteStatus(const h256 &hash, NoteStatus &status) {
-    size_t len = ::platon_get_state_length(hash.data(), hash.size);
-    privacy_assert(len != 0, "illegal note hash");
-    byte *buf = (byte *)malloc(len);
-    platon_get_state(hash.data(), hash.size, buf, len);
-    fetch(RLP(buf, len), status);
+    privacy_assert(FindNoteStatus(hash, status), "illegal note hash");
   }
 
+  // The note may still exist in the predecessor, so it is marked as spent
+  // instead of being deleted
   void DestroyNote(const h256 &hash) {
-    platon_set_state(hash.data(), hash.size, nullptr, 0);
+    const bytes *record = cache_.Get(NoteKey(hash));
+    size_t old_size = record == nullptr ? 0 : record->size();
+    if (record != nullptr &&
+        !IsSpentRecord(bytesConstRef(record->data(), record->size()))) {
+      counters_.NoteRemoved();
+    }
+
+    if (predecessor_.Exists()) {
+      byte spent = static_cast<byte>(NoteRecordFormat::kSpent);
+      cache_.Set(NoteKey(hash), bytesConstRef(&spent, sizeof(spent)));
+      counters_.Resize(old_size, sizeof(spent));
+    } else {
+      cache_.Erase(NoteKey(hash));
+      counters_.Resize(old_size, 0);
+    }
   }
 
-  void CreateNote(const NoteStatus &status) {
-    RLPStream stream;
-    stream.reserve(70);
-    stream << status;
-    DEBUG("create note status:", status.hash.toString());
-    platon_set_state(status.hash.data(), status.hash.size, stream.out().data(),
-                     stream.out().size());
+  // Make sure a live note is in the local state, a note of the predecessor is
+  // copied forward
+  bool TouchNote(const h256 &hash) {
+    NoteLookup lookup = LookupNote(hash, nullptr);
+    if (lookup == NoteLookup::kMissing && predecessor_.Exists()) {
+      NoteStatus status;
+      if (!predecessor_.FindNote(hash, status)) return false;
+      CopyForward(status);
+      if ((Options() & kNoteExport) != 0) BumpStateVersion();
+      return true;
+    }
+    return lookup == NoteLookup::kFound;
+  }
+
+  void CopyForward(const NoteStatus &status) {
+    uint32_t sender_id = senders_.Intern(
+        bytesConstRef(status.sender.data(), status.sender.size()));
+    CreateNote(status.hash,
+               bytesConstRef(status.owner.data(), status.owner.size()),
+               sender_id);
+    if ((Options() & kNoteExport) != 0) LiveNotes().Append(status.hash);
+  }
+
+  void CreateNote(const h256 &hash, const bytesConstRef &owner,
+                  uint32_t sender_id) {
+    bytes record;
+    EncodeNoteRecord(owner, sender_id, record);
+    DEBUG("create note status:", hash.toString());
+    const bytes *old = cache_.Get(NoteKey(hash));
+    counters_.Resize(old == nullptr ? 0 : old->size(), record.size());
+    counters_.NoteAdded();
+    cache_.Set(NoteKey(hash), bytesConstRef(record.data(), record.size()));
+  }
+
+  void FlushState() {
+    cache_.Flush();
+    counters_.Flush();
+  }
+
+  bytesConstRef NoteKey(const h256 &hash) {
+    return bytesConstRef(hash.data(), hash.size);
   }
 
   void UpdateInputNotes(const InputNotes &inputs) {
     DEBUG("update note");
+    bool inherit = predecessor_.Exists();
+    std::vector<h256> inherited;
+    bool note_export = (Options() & kNoteExport) != 0;
+    bool owner_index = (Options() & kOwnerIndex) != 0;
     for (auto &input : inputs) {
       DEBUG("destroy note:", input.hash.toString());
 
-      privacy_assert(HasNote(input.hash), "input note does not exist");
+      bytes record;
+      NoteLookup lookup = ReadNoteRecord(input.hash, record);
+      if (lookup == NoteLookup::kMissing && inherit) {
+        // Approve copies a note forward, so it has no approval here
+        inherited.push_back(input.hash);
+      } else {
+        privacy_assert(lookup == NoteLookup::kFound,
+                       "input note does not exist");
+      }
       DestroyNote(input.hash);
-      DelApproval(input.hash);
+      counters_.NoteDestroyed();
+      if (lookup == NoteLookup::kFound &&
+          MayHaveApproval(bytesConstRef(record.data(), record.size()))) {
+        DelApproval(input.hash);
+      }
+      if (owner_index) {
+        OwnerIndex(input.owner.ToBytesConstRef()).Remove(input.hash);
+      }
+      if (note_export && lookup == NoteLookup::kFound) {
+        LiveNotes().Remove(input.hash);
+      }
+    }
+    if (note_export && !inputs.empty()) BumpStateVersion();
+
+    if (!inherited.empty()) {
+      for (auto &status : predecessor_.FindNotes(inherited)) {
+        privacy_assert(status.hash != h256(), "input note does not exist");
+      }
     }
     DEBUG("update input success");
   }
 
   void UpdateOutputNotes(const OutputNotes &outputs,
                          const platon::bytesConstRef &sender) {
+    uint32_t sender_id = senders_.Intern(sender);
+    bool inherit = predecessor_.Exists();
+    std::vector<h256> unknown;
+    bool note_export = (Options() & kNoteExport) != 0;
+    bool owner_index = (Options() & kOwnerIndex) != 0;
     for (auto &output : outputs) {
       DEBUG("create note:", output.hash.toString());
-      privacy_assert(!HasNote(output.hash), output.hash.toString(),
+      NoteLookup lookup = LookupNote(output.hash, nullptr);
+      privacy_assert(lookup != NoteLookup::kFound, output.hash.toString(),
                      "output note already exists");
-      NoteStatus status{std::move(output.owner.ToBytes()),
-                        std::move(output.hash), sender.toBytes()};
-      CreateNote(status);
+      if (lookup == NoteLookup::kMissing && inherit) {
+        unknown.push_back(output.hash);
+      }
+      CreateNote(output.hash, output.owner.ToBytesConstRef(), sender_id);
+      if (owner_index) {
+        OwnerIndex(output.owner.ToBytesConstRef()).Append(output.hash);
+      }
+      if (note_export) LiveNotes().Append(output.hash);
+      counters_.NoteCreated();
+    }
+    if ((Options() & kNoteTree) != 0) AppendNoteTree(outputs);
+    if (note_export && !outputs.empty()) BumpStateVersion();
+
+    if (!unknown.empty()) {
+      for (auto &status : predecessor_.FindNotes(unknown)) {
+        privacy_assert(status.hash == h256(), status.hash.toString(),
+                       "output note already exists");
+      }
     }
     DEBUG("update output success");
   }
 
+  // Leaves are published so that inclusion paths can be built off chain, the
+  // tree only keeps its frontier
+  void AppendNoteTree(const OutputNotes &outputs) {
+    if (outputs.empty()) return;
+    NoteTree tree;
+    uint64_t first = tree.Size();
+    std::vector<h256> leaves;
+    leaves.reserve(outputs.size());
+    for (auto &output : outputs) {
+      tree.Append(output.hash);
+      leaves.push_back(output.hash);
+    }
+    tree.Flush();
+    PLATON_EMIT_EVENT0(NoteTreeEvent, first, leaves);
+  }
+
+  NoteList<"owner_index"_n> OwnerIndex(const bytesConstRef &owner) {
+    return NoteList<"owner_index"_n>(owner);
+  }
+
+  // All the live notes of the storage, in creation order
+  NoteList<"live_notes"_n> LiveNotes() {
+    return NoteList<"live_notes"_n>(bytesConstRef());
+  }
+
+  uint64_t StateVersion() {
+    uint64_t version = 0;
+    if (platon_get_state_length((const byte *)&kStateVersion,
+                                sizeof(kStateVersion)) == sizeof(version)) {
+      platon_get_state((const byte *)&kStateVersion, sizeof(kStateVersion),
+                       (byte *)&version, sizeof(version));
+    }
+    return version;
+  }
+
+  // Sweep position of DrainOldStorage, no value before the first call, the
+  // next predecessor note while the sweep runs and a single byte once it is
+  // done
+  bool DrainCursor(h256 &cursor) {
+    size_t length =
+        platon_get_state_length((const byte *)&kDrain, sizeof(kDrain));
+    if (length == cursor.size) {
+      platon_get_state((const byte *)&kDrain, sizeof(kDrain), cursor.data(),
+                       cursor.size);
+    }
+    return length == 0 || length == cursor.size;
+  }
+
+  void SetDrainCursor(const h256 &cursor) {
+    if (cursor == h256()) {
+      byte done = 1;
+      platon_set_state((const byte *)&kDrain, sizeof(kDrain), &done,
+                       sizeof(done));
+    } else {
+      platon_set_state((const byte *)&kDrain, sizeof(kDrain), cursor.data(),
+                       cursor.size);
+    }
+  }
+
+  void BumpStateVersion() {
+    uint64_t version = StateVersion() + 1;
+    platon_set_state((const byte *)&kStateVersion, sizeof(kStateVersion),
+                     (const byte *)&version, sizeof(version));
+  }
+
   void SetInitialize(bool init) {
-    byte status = static_cast<byte>(init);
+    SetInitializeStatus(init ? kInitialized : kUninitialized);
+  }
+
+  void SetInitializeStatus(byte status) {
     platon_set_state((const byte *)&kInitialize, sizeof(kInitialize), &status,
                      sizeof(status));
   }
 
-  bool Initialize() {
+  bool Initialize() { return InitializeStatus() != kUninitialized; }
+
+  // Retired storages only serve reads for their lazy migration successor
+  void CheckWritable() {
+    byte status = InitializeStatus();
+    privacy_assert(status != kUninitialized, "uninitialized");
+    privacy_assert(status != kRetired, "storage is retired");
+  }
+
+  byte InitializeStatus() {
+    byte status = kUninitialized;
     if (platon_get_state_length((const byte *)&kInitialize,
-                                sizeof(kInitialize)) == 0) {
-      return false;
+                                sizeof(kInitialize)) == sizeof(status)) {
+      platon_get_state((const byte *)&kInitialize, sizeof(kInitialize),
+                       &status, sizeof(status));
     }
-
-    byte status = 0;
-    platon_get_state((const byte *)&kInitialize, sizeof(kInitialize), &status,
-                     sizeof(status));
-    return static_cast<bool>(status);
+    return status;
   }
 
   void SetMintBurn(bool mint_burn) {
@@ -230,19 +689,55 @@ class Storage : public StorageInterface, public Contract {
   }
 
   bool MintBurn() {
-    byte status;
-    platon_get_state((const byte *)&kMintBurn, sizeof(kMintBurn), &status,
-                     sizeof(status));
+    byte status = 0;
+    if (platon_get_state_length((const byte *)&kMintBurn, sizeof(kMintBurn)) ==
+        sizeof(status)) {
+      platon_get_state((const byte *)&kMintBurn, sizeof(kMintBurn), &status,
+                       sizeof(status));
+    }
     return static_cast<bool>(status);
   }
 
+  void SetOptions(uint32_t options) {
+    platon_set_state((const byte *)&kOptions, sizeof(kOptions),
+                     (const byte *)&options, sizeof(options));
+  }
+
+  uint32_t Options() {
+    uint32_t options = 0;
+    if (platon_get_state_length((const byte *)&kOptions, sizeof(kOptions)) ==
+        sizeof(options)) {
+      platon_get_state((const byte *)&kOptions, sizeof(kOptions),
+                       (byte *)&options, sizeof(options));
+    }
+    return options;
+  }
+
   const uint64_t kApproveKeyPrefix = uint64_t(Name::Raw("approve"_n));
+  SenderTable senders_;
+  StateCache cache_;
+  StorageCounters counters_;
+  StoragePredecessor predecessor_;
   const uint64_t kInitialize = uint64_t(Name::Raw("initialize"_n));
   const uint64_t kMintBurn = uint64_t(Name::Raw("mint_burn"_n));
+  const uint64_t kOptions = uint64_t(Name::Raw("options"_n));
+  const uint64_t kStateVersion = uint64_t(Name::Raw("state_ver"_n));
+  const uint64_t kDrain = uint64_t(Name::Raw("drain"_n));
+  const uint32_t kSupportedOptions =
+      kOwnerIndex | kLazyMigrate | kNoteExport | kNoteTree;
+  const size_t kMaxDrainSize = 200;
+  static constexpr byte kUninitialized = 0;
+  static constexpr byte kInitialized = 1;
+  static constexpr byte kRetired = 2;
 
  private:
   PLATON_EVENT2(StorageMigrateEvent, const Address &, const Address &);
+  PLATON_EVENT0(NoteTreeEvent, uint64_t, const std::vector<h256> &);
 };
 
-PLATON_DISPATCH(Storage, (init)(Approve)(GetApproval)(Mint)(Burn)(
-                             CreateRegistry)(GetNote)(UpdateNotes)(Migrate))
\ No newline at end of file
+PLATON_DISPATCH(Storage,
+                (init)(Approve)(GetApproval)(Mint)(Burn)(CreateRegistry)(
+                    CreateRegistryWithOptions)(GetNote)(GetNotes)(
+                    GetNotesByOwner)(NoteRoot)(ExportNotes)(GetStats)(
+                    UpdateNotes)(UpdateNotesBatch)(Migrate)(Inherit)(
+                    DrainOldStorage))
\ No newline at end of file
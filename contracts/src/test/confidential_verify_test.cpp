@@ -0,0 +1,84 @@
+#define PRIVACY_STUB_TX_VERIFY
+#define PRIVACY_BATCH_TX_VERIFY
+#include <platon/platon.hpp>
+#include "privacy/confidential_verify.hpp"
+using namespace platon;
+
+using namespace privacy;
+
+struct VerifyResult {
+  bool legal = false;
+  uint32_t calls = 0;               // verification host calls
+  std::vector<uint8_t> tx_types;    // tx_type of every ConfidentialUTXO
+  std::vector<Address> authorized;  // authorized_address of every one
+  PLATON_SERIALIZE(VerifyResult, (legal)(calls)(tx_types)(authorized))
+};
+
+/*
+ * Runs the verification paths of privacy/confidential_verify.hpp against the
+ * node-free stub of the host functions. A stub transaction is the RLP of the
+ * ConfidentialUTXO it verifies to. Built with PRIVACY_BATCH_TX_VERIFY so that
+ * both paths can be compared, VerifyEach runs the default path explicitly.
+ */
+CONTRACT ConfidentialVerifyTest : public platon::Contract {
+ public:
+  ACTION void init() {}
+
+  /**
+   * @brief Verify with one host call per transaction, the default path
+   */
+  CONST VerifyResult VerifyEach(const std::vector<bytes> &txs) {
+    return Verify(txs, internal::TxVerifyEach);
+  }
+
+  /**
+   * @brief Verify with one batched host call, the PRIVACY_BATCH_TX_VERIFY
+   * path
+   */
+  CONST VerifyResult VerifyBatch(const std::vector<bytes> &txs) {
+    return Verify(txs, internal::TxVerifyAll);
+  }
+
+  /**
+   * @brief Verify one transaction
+   */
+  CONST VerifyResult VerifyOne(const bytes &tx) {
+    VerifyResult result;
+    bytes buffer;
+    ConfidentialUTXO utxo;
+    result.legal = ConfidentialTxVerify(VectorWrapper(tx), buffer, utxo);
+    result.calls = host::stub::Calls();
+    if (result.legal) {
+      result.tx_types.push_back(utxo.tx_type);
+      result.authorized.push_back(utxo.authorized_address);
+    }
+    return result;
+  }
+
+ private:
+  using VerifyFunc = int32_t (*)(const std::vector<VectorWrapper> &, bytes &);
+
+  VerifyResult Verify(const std::vector<bytes> &txs, VerifyFunc verify) {
+    std::vector<VectorWrapper> views;
+    for (auto &tx : txs) views.emplace_back(tx);
+
+    VerifyResult result;
+    bytes buffer;
+    result.legal = verify(views, buffer) > 0;
+    result.calls = host::stub::Calls();
+    if (!result.legal) return result;
+
+    RLP rlp(buffer);
+    privacy_assert(rlp.itemCount() == txs.size(), "result count mismatch");
+    for (size_t i = 0; i < txs.size(); i++) {
+      ConfidentialUTXO utxo;
+      fetch(rlp[i], utxo);
+      result.tx_types.push_back(utxo.tx_type);
+      result.authorized.push_back(utxo.authorized_address);
+    }
+    return result;
+  }
+};
+
+PLATON_DISPATCH(ConfidentialVerifyTest, (init)(VerifyEach)(VerifyBatch)(
+                                            VerifyOne))
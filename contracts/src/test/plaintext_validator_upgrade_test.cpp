@@ -8,8 +8,9 @@ using namespace privacy;
 CONTRACT PlaintextValidatorUpgradeTest : public ValidatorInterface,
                                          public platon::Contract {
  public:
-  PLATON_EVENT2(CreateNoteDetailEvent, const h256 &, const platon::bytes &,
-                const platon::bytes &, u128, const platon::bytes &)
+  PLATON_EVENT2(CreateNoteDetailEvent, const h256 &,
+                const platon::bytesConstRef &, const platon::bytesConstRef &,
+                u128, const platon::bytesConstRef &)
  public:
   ACTION void init() {}
 
@@ -109,7 +110,7 @@ CONTRACT PlaintextValidatorUpgradeTest : public ValidatorInterface,
   platon::bytes ValidateTransfer(const Address &spender,
                                  const PlaintextData &plaintext_data) {
     PlaintextUTXO utxo;
-    fetch(RLP(plaintext_data.data), utxo);
+    fetch(RLP(plaintext_data.data.ToBytesConstRef()), utxo);
 
     InputNotes inputs;
     u128 input_total = 0;
@@ -129,11 +130,11 @@ CONTRACT PlaintextValidatorUpgradeTest : public ValidatorInterface,
   platon::bytes ValidateApprove(const Address &note_owner,
                                 const PlaintextData &plaintext_data) {
     PlaintextApprove approve;
-    fetch(RLP(plaintext_data.data), approve);
+    fetch(RLP(plaintext_data.data.ToBytesConstRef()), approve);
 
     DEBUG("note owner", note_owner.toString(), "approve",
-          Address(approve.owner).toString());
-    privacy_assert(Address(approve.owner) == note_owner,
+          Address(approve.owner.ToBytesConstRef()).toString());
+    privacy_assert(Address(approve.owner.ToBytesConstRef()) == note_owner,
                    "recover address mismatch with note owner");
 
     RLPStream stream;
@@ -142,7 +143,7 @@ CONTRACT PlaintextValidatorUpgradeTest : public ValidatorInterface,
     ::platon_sha3(stream.out().data(), stream.out().size(), hash.data(),
                   hash.size);
     DEBUG("validate approve success:", hash.toString(),
-          "shared_sign:", toHex(approve.shared_sign))
+          "shared_sign:", toHex(approve.shared_sign.ToBytesConstRef()))
 
     return SerializeResult(ApproveResult{hash, approve.shared_sign});
   }
@@ -150,11 +151,12 @@ CONTRACT PlaintextValidatorUpgradeTest : public ValidatorInterface,
   platon::bytes ValidateMint(const Address &note_owner,
                              const PlaintextData &plaintext_data) {
     PlaintextMint mint;
-    fetch(RLP(plaintext_data.data), mint);
+    fetch(RLP(plaintext_data.data.ToBytesConstRef()), mint);
     OutputNotes outputs;
     platon::u128 total_mint = 0;
     for (const auto &i : mint.outputs) {
-      privacy_assert(note_owner == Address(i.owner), "illegal note owner");
+      privacy_assert(note_owner == Address(i.owner.ToBytesConstRef()),
+                     "illegal note owner");
       total_mint += i.value;
       RLPStream stream;
       stream << *reinterpret_cast<const PlaintextNote *>(&i);
@@ -162,8 +164,9 @@ CONTRACT PlaintextValidatorUpgradeTest : public ValidatorInterface,
       platon_sha3(stream.out().data(), stream.out().size(), hash.data(),
                   hash.size);
       outputs.push_back(OutputNote{i.owner, hash});
-      PLATON_EMIT_EVENT2(CreateNoteDetailEvent, hash, i.owner, i.owner, i.value,
-                         i.random);
+      PLATON_EMIT_EVENT2(CreateNoteDetailEvent, hash, i.owner.ToBytesConstRef(),
+                         i.owner.ToBytesConstRef(), i.value,
+                         i.random.ToBytesConstRef());
     }
 
     return SerializeResult(MintResult{mint.old_mint_hash, total_mint, outputs});
@@ -172,7 +175,7 @@ CONTRACT PlaintextValidatorUpgradeTest : public ValidatorInterface,
   CONST platon::bytes ValidateBurn(const Address &note_owner,
                                    const PlaintextData &plaintext_data) {
     PlaintextBurn burn;
-    fetch(RLP(plaintext_data.data), burn);
+    fetch(RLP(plaintext_data.data.ToBytesConstRef()), burn);
     InputNotes input_notes;
     u128 total_burn = 0;
     privacy_assert(
@@ -198,13 +201,13 @@ CONTRACT PlaintextValidatorUpgradeTest : public ValidatorInterface,
     PlaintextProof plain_proof;
     fetch(RLP(proof), plain_proof);
     auto sha3 = platon_sha3(plain_proof.data);
-    if (platon_ecrecover(sha3, plain_proof.signature, spender) != 0) {
+    if (platon_ecrecover(sha3, plain_proof.signature.ToBytes(), spender) != 0) {
       DEBUG("check proof signature failed")
       return -1;
     }
 
     DEBUG("check proof signature success")
-    fetch(RLP(plain_proof.data), plaintext);
+    fetch(RLP(plain_proof.data.ToBytesConstRef()), plaintext);
 
     if (!MatchVersion(plaintext.version)) {
       DEBUG("check version failed");
@@ -252,11 +255,12 @@ CONTRACT PlaintextValidatorUpgradeTest : public ValidatorInterface,
       ::platon_sha3(stream.out().data(), stream.out().size(), hash.data(),
                     hash.size);
       Address result;
-      platon_ecrecover(hash, i.signature, result);
+      platon_ecrecover(hash, i.signature.ToBytes(), result);
       DEBUG("stream:", toHex(stream.out()), "note hash", hash.toString(),
             "spender", Address(i.spender).toString(), "result",
-            result.toString(), "owner", Address(i.owner).toString());
-      Address owner(i.owner);
+            result.toString(), "owner",
+            Address(i.owner.ToBytesConstRef()).toString());
+      Address owner(i.owner.ToBytesConstRef());
       if (result == owner) {
         stream.clear();
         stream << *reinterpret_cast<const PlaintextNote *>(&i);
@@ -296,8 +300,9 @@ CONTRACT PlaintextValidatorUpgradeTest : public ValidatorInterface,
             "hash:", hash.toString());
 
       outputs.push_back(OutputNote{i.owner, hash});
-      PLATON_EMIT_EVENT2(CreateNoteDetailEvent, hash, i.owner, i.owner, i.value,
-                         i.random);
+      PLATON_EMIT_EVENT2(CreateNoteDetailEvent, hash, i.owner.ToBytesConstRef(),
+                         i.owner.ToBytesConstRef(), i.value,
+                         i.random.ToBytesConstRef());
     }
 
     if (utxo.public_value < 0) {
@@ -0,0 +1,108 @@
+#include <platon/platon.hpp>
+#include "privacy/state_cache.hpp"
+using namespace platon;
+
+using namespace privacy;
+
+/*
+ * Drives privacy/state_cache.hpp through the host state. Every action uses a
+ * fresh cache, as the storages do, and checks the cache against the state it
+ * flushed with CONST Read.
+ */
+CONTRACT StateCacheTest : public platon::Contract {
+ public:
+  ACTION void init() {}
+
+  /**
+   * @brief Set every key to a scratch value and then to value in one cache,
+   * only the last value may reach the state
+   */
+  ACTION void Write(const std::vector<h256> &keys, const bytes &value) {
+    StateCache cache;
+    bytes scratch(value);
+    scratch.push_back(0);
+    for (auto &key : keys) {
+      cache.Set(Key(key), bytesConstRef(scratch.data(), scratch.size()));
+      cache.Set(Key(key), bytesConstRef(value.data(), value.size()));
+    }
+    cache.Flush();
+  }
+
+  /**
+   * @brief Hit, miss, read-your-write and erase on one cache, then flush
+   *
+   * @param present A key that exists in the state, it is erased
+   * @param missing A key that does not exist in the state, it is created and
+   * erased again so it must never be written
+   */
+  ACTION void Check(const h256 &present, const h256 &missing) {
+    StateCache cache;
+    const bytes *hit = cache.Get(Key(present));
+    privacy_assert(hit != nullptr && !hit->empty(), "present key missed");
+    bytes value = *hit;
+    privacy_assert(cache.Get(Key(missing)) == nullptr, "missing key hit");
+
+    cache.Set(Key(missing), bytesConstRef(value.data(), value.size()));
+    const bytes *written = cache.Get(Key(missing));
+    privacy_assert(written != nullptr && *written == value,
+                   "write is not visible");
+
+    cache.Erase(Key(present));
+    privacy_assert(cache.Get(Key(present)) == nullptr, "erased key hit");
+    cache.Erase(Key(missing));
+    privacy_assert(cache.Get(Key(missing)) == nullptr, "erased key hit");
+    cache.Flush();
+    privacy_assert(
+        ::platon_get_state_length(present.data(), present.size) == 0,
+        "erase was not flushed");
+  }
+
+  /**
+   * @brief Fill the cache up to its load limit, lookups of cached keys must
+   * not grow the table, the next new key must. Nothing is flushed.
+   */
+  ACTION void CheckGrowth(const h256 &seed) {
+    StateCache cache;
+    size_t capacity = cache.Capacity();
+    std::vector<h256> keys;
+    for (size_t i = 0; i < capacity / 2; i++) {
+      h256 key = seed;
+      key[0] = static_cast<byte>(i);
+      keys.push_back(key);
+      byte value = static_cast<byte>(i);
+      cache.Set(Key(key), bytesConstRef(&value, sizeof(value)));
+    }
+    privacy_assert(cache.Capacity() == capacity, "cache grew below the limit");
+    for (auto &key : keys) cache.Get(Key(key));
+    privacy_assert(cache.Capacity() == capacity, "lookup grew the cache");
+
+    h256 key = seed;
+    key[0] = static_cast<byte>(capacity / 2);
+    cache.Get(Key(key));
+    privacy_assert(cache.Capacity() == capacity * 2, "insert did not grow");
+    for (size_t i = 0; i < keys.size(); i++) {
+      const bytes *value = cache.Get(Key(keys[i]));
+      privacy_assert(value != nullptr && value->size() == 1 &&
+                         (*value)[0] == static_cast<byte>(i),
+                     "key lost on growth");
+    }
+  }
+
+  /**
+   * @brief Raw state value of a key, empty when it does not exist
+   */
+  CONST bytes Read(const h256 &key) {
+    bytes value(::platon_get_state_length(key.data(), key.size));
+    if (!value.empty()) {
+      ::platon_get_state(key.data(), key.size, value.data(), value.size());
+    }
+    return value;
+  }
+
+ private:
+  bytesConstRef Key(const h256 &key) {
+    return bytesConstRef(key.data(), key.size);
+  }
+};
+
+PLATON_DISPATCH(StateCacheTest, (init)(Write)(Check)(CheckGrowth)(Read))
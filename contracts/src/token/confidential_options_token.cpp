@@ -0,0 +1,26 @@
+#include "token/confidential_token.hpp"
+
+/*
+ * Confidential token whose acl registration selects optional behaviours, such
+ * as the StorageOption flags, storage shards or a shared validator. It is the
+ * same token as ConfidentialToken apart from the extra init argument.
+ */
+CONTRACT ConfidentialOptionsToken : public privacy::MintBurnConfidentialToken,
+                                 public Contract {
+ public:
+  ACTION void init(const std::string &name, const std::string &symbol,
+                   const Address &registry_address, uint32_t validator_version,
+                   uint32_t storage_version, u128 scaling_factor,
+                   const Address &token_address,
+                   const privacy::RegistryOptions &options) {
+    privacy::BaseConfidentialToken::init(
+        name, symbol, registry_address, validator_version, storage_version,
+        scaling_factor, token_address, options);
+  }
+};
+
+PLATON_DISPATCH(ConfidentialOptionsToken,
+                (init)(Transfer)(Approve)(GetApproval)(GetNotes)(GetAcl)(
+                    Name)(Symbol)(ScalingFactor)(TotalSupply)(UpdateMetaData)(
+                    Mint)(Burn)(UpdateValidator)(UpdateStorage)(SupportProof)(
+                    SetCompactEvents)(CompactEvents))
@@ -15,6 +15,7 @@ CONTRACT ConfidentialToken : public privacy::MintBurnConfidentialToken,
 };
 
 PLATON_DISPATCH(ConfidentialToken,
-                (init)(Transfer)(Approve)(GetApproval)(GetAcl)(Name)(Symbol)(
-                    ScalingFactor)(TotalSupply)(UpdateMetaData)(Mint)(Burn)(
-                    UpdateValidator)(UpdateStorage)(SupportProof))
\ No newline at end of file
+                (init)(Transfer)(Approve)(GetApproval)(GetNotes)(GetAcl)(
+                    Name)(Symbol)(ScalingFactor)(TotalSupply)(UpdateMetaData)(
+                    Mint)(Burn)(UpdateValidator)(UpdateStorage)(SupportProof)(
+                    SetCompactEvents)(CompactEvents))
\ No newline at end of file
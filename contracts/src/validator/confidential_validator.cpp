@@ -1,5 +1,9 @@
 #include <platon/platon.h>
 #include <privacy/confidential_utxo.h>
+#include <privacy/confidential_verify.hpp>
+#include <privacy/proof_digest.hpp>
+#include <privacy/proof_envelope.hpp>
+#include <privacy/proof_handler.hpp>
 #include <privacy/validator_interface.hpp>
 #include "platon/call.hpp"
 #include "privacy/debug/gas/stack_helper.h"
@@ -20,34 +24,68 @@ CONTRACT ConfidentialValidator : public ValidatorInterface, public Contract {
    * @return Return a serialized byte stream of authentication information
    */
   virtual CONST bytesConstRef ValidateProof(const bytesConstRef &proof) override {
-    // fetch confidential proof
-    ConfidentialProof confidential_proof;
-    fetch(RLP(proof), confidential_proof);
+    return Validate(proof);
+  }
 
-    ConfidentialData confidential_data;
-    ConfidentialUTXO utxo;
-    privacy_assert(PreCheck(confidential_proof, confidential_data, utxo) == 0,
-                   "precheck failed");
+  /**
+   * @brief Verify a proof for a token in compact event mode, the result is
+   * the one of ValidateProof but no CreateNoteDetailEvent is emitted
+   *
+   * @param proof Proof byte stream
+   * @return Return a serialized byte stream of authentication information
+   */
+  CONST bytesConstRef
+  ValidateCompactProof(const bytesConstRef &proof) override {
+    emit_details_ = false;
+    return Validate(proof);
+  }
 
-    switch (ProofType(utxo.tx_type)) {
-      case ProofType::kTransfer:
-      case ProofType::kDeposit:
-      case ProofType::kWithdraw:
-        return ValidateTransfer(utxo, confidential_data.confidential_tx,
-                                confidential_data.extra_data);
-      case ProofType::kMint:
-        return ValidateMint(utxo, confidential_data.extra_data,
-                            confidential_proof.data);
-      case ProofType::kBurn:
-        return ValidateBurn(utxo, confidential_data.extra_data,
-                            confidential_proof.data);
-      case ProofType::kApprove:
-        return ValidateApprove(utxo, confidential_data.extra_data);
-      default:
-        privacy_assert(false, "unknow proof type");
+  /**
+   * @brief Verify several proofs in one call, the call fails as a whole if
+   * any proof is illegal and the revert log carries its batch index. The
+   * cryptographic verification of all the proofs is done up front, by one
+   * batched host call when built with PRIVACY_BATCH_TX_VERIFY, otherwise by
+   * one host call per proof at the cost of single ValidateProof calls.
+   *
+   * @param proofs Proof byte streams
+   * @return Serialized authentication information of every proof, in the same
+   * order
+   */
+  CONST std::vector<bytesConstRef> ValidateProofs(
+      const std::vector<bytesConstRef> &proofs) override {
+    if (proofs.empty()) return {};
+    if (proofs.size() == 1) return {Validate(proofs[0])};
+
+    std::vector<ProofDigest> digests(proofs.size());
+    std::vector<ConfidentialFields> fields(proofs.size());
+    std::vector<platon::VectorWrapper> txs;
+    txs.reserve(proofs.size());
+    for (size_t i = 0; i < proofs.size(); i++) {
+      PrivacyRevert::BatchIndex() = i;
+      privacy_assert(FetchFields(proofs[i], digests[i], fields[i]) == 0,
+                     "precheck failed");
+      txs.push_back(fields[i].confidential_tx);
     }
+    PrivacyRevert::BatchIndex() = -1;
 
-    return bytesConstRef();
+    bytes verify_result;
+    std::vector<ConfidentialUTXO> utxos;
+    if (!ConfidentialTxVerifyBatch(txs, verify_result, utxos)) {
+      FindIllegalTx(txs);
+    }
+    DEBUG("batch cryptographic verification success");
+
+    std::vector<bytesConstRef> results;
+    results.reserve(proofs.size());
+    for (size_t i = 0; i < proofs.size(); i++) {
+      PrivacyRevert::BatchIndex() = i;
+      privacy_assert(CheckProofSignature(digests[i], utxos[i]) == 0,
+                     "precheck failed");
+      results.push_back(ValidateUTXO(digests[i], fields[i], utxos[i]));
+    }
+    PrivacyRevert::BatchIndex() = -1;
+    DEBUG("validate proofs success, proofs:", proofs.size());
+    return results;
   }
 
   /**
@@ -104,31 +142,83 @@ CONTRACT ConfidentialValidator : public ValidatorInterface, public Contract {
   }
 
  private:
+  bytesConstRef Validate(const bytesConstRef &proof) {
+    ProofDigest digest;
+    ConfidentialFields fields;
+    platon::bytes verify_result;  // referenced by utxo
+    ConfidentialUTXO utxo;
+    privacy_assert(PreCheck(proof, digest, fields, verify_result, utxo) == 0,
+                   "precheck failed");
+
+    return ValidateUTXO(digest, fields, utxo);
+  }
+
+  bytesConstRef ValidateUTXO(ProofDigest &digest,
+                             const ConfidentialFields &fields,
+                             const ConfidentialUTXO &utxo) {
+    static_assert(UniqueProofHandlers(Handlers()), "duplicate proof version");
+    Handler handler =
+        FindProofHandler(Handlers(), DispatchVersion(fields.version, utxo));
+    privacy_assert(handler != nullptr, "unknow proof type");
+    return (this->*handler)(digest, fields, utxo);
+  }
+
+  /**
+   * @brief Handler version a proof is dispatched to.
+   *
+   * Nested envelope proofs are dispatched on the tx_type of their confidential
+   * tx, as before the handler table, the type byte of their version is not
+   * checked against it. Flat proofs decode their fields by the type byte of
+   * the version, so this adds a rule for them only: a flat proof whose
+   * confidential tx is of another type than its version is rejected.
+   */
+  uint32_t DispatchVersion(uint32_t version, const ConfidentialUTXO &utxo) {
+    if (FlatProofVersion(version)) {
+      privacy_assert(utxo.tx_type == uint8_t(version & 0xFF),
+                     "proof type mismatch");
+      return version;
+    }
+    return (HandlerVersion(version) & 0xFFFFFF00) | utxo.tx_type;
+  }
+
+  /**
+   * @brief Note of a proof, the owner is the RLP list {ephemeral_pk, sign_pk}.
+   * This is the one owner encoding of the storage and of the events, for
+   * every proof version. Minor version 2 proofs must carry both points as
+   * 32-byte compressed encodings.
+   */
+  template <bool kFixedPoints>
   void MakeInputNote(const ConfidentialInputNote &one_note, InputNote &input) {
+    if (kFixedPoints) {
+      privacy_assert(one_note.ephemeral_pk.size() == kPointSize &&
+                         one_note.sign_pk.size() == kPointSize,
+                     "invalid note owner");
+    }
     input.owner = rlp_encode(one_note.ephemeral_pk, one_note.sign_pk);
 
     ::platon_sha3(one_note.note_id.data(), one_note.note_id.size(),
                   input.hash.data(), input.hash.size);
   }
 
+  template <bool kFixedPoints>
   OutputNote MakeOutputNote(const ConfidentialInputNote &one_note,
                             const platon::VectorWrapper &meta_data) {
     OutputNote output_note;
-    MakeInputNote(one_note, output_note);
+    MakeInputNote<kFixedPoints>(one_note, output_note);
     output_note.meta_data = meta_data;
     return output_note;
   }
 
-  bytesConstRef ValidateTransfer(const ConfidentialUTXO &utxo,
-                                 const platon::VectorWrapper &confidential_tx,
-                                 const platon::VectorWrapper &extra_data) {
-    TransferExtra transfer_extra_data;
-    fetch(RLP(extra_data.ToBytesConstRef()), transfer_extra_data);
+  template <bool kFixedPoints>
+  bytesConstRef ValidateTransfer(ProofDigest &digest,
+                                 const ConfidentialFields &fields,
+                                 const ConfidentialUTXO &utxo) {
+    const TransferExtra &transfer_extra_data = fields.transfer;
 
     InputNotes inputs;
     for (const ConfidentialInputNote &one_note : utxo.inputs) {
       InputNote one_input;
-      MakeInputNote(one_note, one_input);
+      MakeInputNote<kFixedPoints>(one_note, one_input);
       inputs.emplace_back(std::move(one_input));
     }
 
@@ -142,11 +232,13 @@ CONTRACT ConfidentialValidator : public ValidatorInterface, public Contract {
         meta_data = *iter_meta++;
       }
 
-      OutputNote one_output = MakeOutputNote(one, meta_data);
-      PLATON_EMIT_EVENT1(CreateNoteDetailEvent, one_output.hash,
-                         one_output.owner.ToBytesConstRef(),
-                         one.cipher_value.ToBytesConstRef(),
-                         one_output.meta_data.ToBytesConstRef());
+      OutputNote one_output = MakeOutputNote<kFixedPoints>(one, meta_data);
+      if (emit_details_) {
+        PLATON_EMIT_EVENT1(CreateNoteDetailEvent, one_output.hash,
+                           one_output.owner.ToBytesConstRef(),
+                           one.cipher_value.ToBytesConstRef(),
+                           one_output.meta_data.ToBytesConstRef());
+      }
       outputs.emplace_back(std::move(one_output));
     }
 
@@ -159,8 +251,8 @@ CONTRACT ConfidentialValidator : public ValidatorInterface, public Contract {
     // check deposit signature
     if (ProofType(utxo.tx_type) == ProofType::kDeposit) {
       h256 hash;
-      ::platon_sha3(confidential_tx.data(), confidential_tx.size(), hash.data(),
-                    hash.size);
+      ::platon_sha3(fields.confidential_tx.data(),
+                    fields.confidential_tx.size(), hash.data(), hash.size);
       Address result;
       platon_ecrecover(
           hash.data(), transfer_extra_data.deposit_signature.data(),
@@ -195,18 +287,18 @@ CONTRACT ConfidentialValidator : public ValidatorInterface, public Contract {
                                      utxo.authorized_address.size)});
   }
 
-  bytesConstRef ValidateApprove(const ConfidentialUTXO &utxo,
-                                const platon::VectorWrapper &extra_data) {
+  bytesConstRef ValidateApprove(ProofDigest &digest,
+                                const ConfidentialFields &fields,
+                                const ConfidentialUTXO &utxo) {
     privacy_assert(false, "unknow proof type");
-
     return bytesConstRef();
   }
 
-  bytesConstRef ValidateMint(const ConfidentialUTXO &utxo,
-                             const platon::VectorWrapper &extra_data,
-                             const platon::VectorWrapper &confidential_data) {
-    MintExtra mint_extra_data;
-    fetch(RLP(extra_data.ToBytesConstRef()), mint_extra_data);
+  template <bool kFixedPoints>
+  bytesConstRef ValidateMint(ProofDigest &digest,
+                             const ConfidentialFields &fields,
+                             const ConfidentialUTXO &utxo) {
+    const MintExtra &mint_extra_data = fields.mint;
 
     OutputNotes outputs;
     const std::vector<platon::VectorWrapper> &vect_meta_data =
@@ -218,11 +310,13 @@ CONTRACT ConfidentialValidator : public ValidatorInterface, public Contract {
         meta_data = *iter_meta++;
       }
 
-      OutputNote one_output = MakeOutputNote(one, meta_data);
-      PLATON_EMIT_EVENT1(CreateNoteDetailEvent, one_output.hash,
-                         one_output.owner.ToBytesConstRef(),
-                         one.cipher_value.ToBytesConstRef(),
-                         one_output.meta_data.ToBytesConstRef());
+      OutputNote one_output = MakeOutputNote<kFixedPoints>(one, meta_data);
+      if (emit_details_) {
+        PLATON_EMIT_EVENT1(CreateNoteDetailEvent, one_output.hash,
+                           one_output.owner.ToBytesConstRef(),
+                           one.cipher_value.ToBytesConstRef(),
+                           one_output.meta_data.ToBytesConstRef());
+      }
       outputs.emplace_back(std::move(one_output));
     }
 
@@ -230,27 +324,23 @@ CONTRACT ConfidentialValidator : public ValidatorInterface, public Contract {
 
     DEBUG("validate mint success");
 
-    h256 sha3_data;
-    ::platon_sha3(confidential_data.data(), confidential_data.size(),
-                  sha3_data.data(), sha3_data.size);
-
     return SerializeResultRef(
-        MintResult{mint_extra_data.old_mint_hash,
-                   platon_sha3(confidential_data), total_mint, outputs,
+        MintResult{mint_extra_data.old_mint_hash, digest.DataHash(),
+                   total_mint, outputs,
                    bytesConstRef(utxo.authorized_address.data(),
                                  utxo.authorized_address.size)});
   }
 
-  CONST bytesConstRef ValidateBurn(
-      const ConfidentialUTXO &utxo, const platon::VectorWrapper &extra_data,
-      const platon::VectorWrapper &confidential_data) {
-    BurnExtra burn_extra_data;
-    fetch(RLP(extra_data.ToBytesConstRef()), burn_extra_data);
+  template <bool kFixedPoints>
+  bytesConstRef ValidateBurn(ProofDigest &digest,
+                             const ConfidentialFields &fields,
+                             const ConfidentialUTXO &utxo) {
+    const BurnExtra &burn_extra_data = fields.burn;
 
     InputNotes inputs;
     for (const ConfidentialInputNote &one_note : utxo.inputs) {
       InputNote one_input;
-      MakeInputNote(one_note, one_input);
+      MakeInputNote<kFixedPoints>(one_note, one_input);
       inputs.emplace_back(std::move(one_input));
     }
 
@@ -258,62 +348,123 @@ CONTRACT ConfidentialValidator : public ValidatorInterface, public Contract {
 
     DEBUG("validate burn success");
 
-    h256 sha3_data;
-    ::platon_sha3(confidential_data.data(), confidential_data.size(),
-                  sha3_data.data(), sha3_data.size);
-
     return SerializeResultRef(
-        BurnResult{burn_extra_data.old_burn_hash,
-                   platon_sha3(confidential_data), total_burn, inputs,
+        BurnResult{burn_extra_data.old_burn_hash, digest.DataHash(),
+                   total_burn, inputs,
                    bytesConstRef(utxo.authorized_address.data(),
                                  utxo.authorized_address.size)});
   }
 
-  int PreCheck(const ConfidentialProof &confidential_proof,
-               ConfidentialData &confidential_data, ConfidentialUTXO &utxo) {
-    // check version
-    fetch(RLP(confidential_proof.data.ToBytesConstRef()), confidential_data);
+  int PreCheck(const bytesConstRef &proof, ProofDigest &digest,
+               ConfidentialFields &fields, platon::bytes &result,
+               ConfidentialUTXO &utxo) {
+    if (FetchFields(proof, digest, fields) != 0) {
+      return -1;
+    }
+
+    // Cryptographic verification
+    if (TxVerify(fields.confidential_tx, result, utxo) != 0) {
+      return -1;
+    }
+
+    return CheckProofSignature(digest, utxo);
+  }
+
+  /**
+   * @brief Decode a proof of either envelope. The flat envelope is decoded in
+   * one pass, its fixed header tells the proof type and so the field list
+   * before any field is read.
+   *
+   * @param proof Proof byte stream
+   * @param digest Digest context over the signed part of the proof
+   * @param fields The decoded proof
+   * @return Return 0 on success, -1 on failure
+   */
+  int FetchFields(const bytesConstRef &proof, ProofDigest &digest,
+                  ConfidentialFields &fields) {
+    bool flat_proof = IsFlatProof(proof);
+    FlatProof flat;
+    ConfidentialData confidential_data;
+    if (flat_proof) {
+      if (!OpenFlatProof(proof, flat)) {
+        DEBUG("open flat proof failed");
+        return -1;
+      }
+      fields.version = flat.version;
+      digest = ProofDigest(flat.signed_data, flat.signature);
+    } else {
+      ConfidentialProof confidential_proof;
+      fetch(RLP(proof), confidential_proof);
+      fetch(RLP(confidential_proof.data.ToBytesConstRef()), confidential_data);
+      if (FlatProofVersion(confidential_data.version)) {
+        DEBUG("flat proof version in a nested envelope");
+        return -1;
+      }
+      fields.version = confidential_data.version;
+      fields.confidential_tx = confidential_data.confidential_tx;
+      digest = ProofDigest(confidential_proof.data.ToBytesConstRef(),
+                           confidential_proof.signature.ToBytesConstRef());
+    }
 
-    if (!MatchVersion(confidential_data.version)) {
+    // check version
+    if (!MatchVersion(fields.version)) {
       DEBUG("check version failed");
       return -1;
     }
     DEBUG("check version success");
 
-    // Cryptographic verification
-    int32_t result_len =
-        platon_confidential_tx_verify(confidential_data.confidential_tx.data(),
-                                      confidential_data.confidential_tx.size());
-    if (result_len <= 0) {
+    ProofType type = ProofType(fields.version & 0xFF);
+    if (flat_proof) {
+      RLP rlp(flat.fields);
+      if (type == ProofType::kMint) {
+        fetch(rlp, fields.mint);
+        fields.confidential_tx = fields.mint.confidential_tx;
+      } else if (type == ProofType::kBurn) {
+        fetch(rlp, fields.burn);
+        fields.confidential_tx = fields.burn.confidential_tx;
+      } else {
+        fetch(rlp, fields.transfer);
+        fields.confidential_tx = fields.transfer.confidential_tx;
+      }
+    } else {
+      RLP rlp(confidential_data.extra_data.ToBytesConstRef());
+      if (type == ProofType::kMint) {
+        fetch(rlp, static_cast<MintExtra &>(fields.mint));
+      } else if (type == ProofType::kBurn) {
+        fetch(rlp, static_cast<BurnExtra &>(fields.burn));
+      } else {
+        fetch(rlp, static_cast<TransferExtra &>(fields.transfer));
+      }
+    }
+    return 0;
+  }
+
+  int TxVerify(const platon::VectorWrapper &confidential_tx,
+               platon::bytes &result, ConfidentialUTXO &utxo) {
+    if (!ConfidentialTxVerify(confidential_tx, result, utxo)) {
       DEBUG("cryptographic verification failed");
       return -1;
     }
     DEBUG("cryptographic verification success");
+    return 0;
+  }
 
-    // get cryptographic verification results
-    platon::bytes result(result_len);
-    int32_t variable_result =
-        platon_variable_length_result(result.data(), result.size());
-    if (result_len <= 0) {
-      DEBUG("get cryptographic verification results failed");
-      return -1;
+  // The batched verification only tells that some transaction is illegal,
+  // verify them one by one so that the revert names the offending proof
+  void FindIllegalTx(const std::vector<platon::VectorWrapper> &txs) {
+    for (size_t i = 0; i < txs.size(); i++) {
+      PrivacyRevert::BatchIndex() = i;
+      platon::bytes result;
+      ConfidentialUTXO utxo;
+      privacy_assert(TxVerify(txs[i], result, utxo) == 0, "precheck failed");
     }
+    PrivacyRevert::BatchIndex() = -1;
+    privacy_assert(false, "batch cryptographic verification failed");
+  }
 
-    fetch(RLP(result), utxo);
-    DEBUG("fetch cryptographic verification results success");
-
+  int CheckProofSignature(ProofDigest &digest, const ConfidentialUTXO &utxo) {
     // check signature
-    h256 sha3_data;
-    ::platon_sha3(confidential_proof.data.data(),
-                  confidential_proof.data.size(), sha3_data.data(),
-                  sha3_data.size);
-
-    Address signature_address;
-    platon_ecrecover(sha3_data.data(), confidential_proof.signature.data(),
-                     confidential_proof.signature.size(),
-                     signature_address.data());
-
-    if (signature_address != utxo.authorized_address) {
+    if (digest.Signer() != utxo.authorized_address) {
       DEBUG("check proof signature failed")
       return -1;
     }
@@ -329,21 +480,88 @@ CONTRACT ConfidentialValidator : public ValidatorInterface, public Contract {
    * @return Return true on success, false on failure
    */
   bool MatchVersion(uint32_t version) {
-    auto major = static_cast<uint8_t>((version & 0x00FF0000) >> 16);
-    auto minor = static_cast<uint8_t>((version & 0x0000FF00) >> 8);
-    auto type = static_cast<ProofType>((version & 0x000000FF));
-    return (kMajor > major ||
-            (major == kMajor && kMinor >= minor && minor > 0)) &&
-           type >= ProofType::kTransfer && type <= ProofType::kApprove;
+    return FindProofHandler(Handlers(), HandlerVersion(version)) != nullptr;
+  }
+
+  /**
+   * @brief Version of the handlers serving a proof. Proofs of major version 0
+   * predate the handler table, they were accepted with any minor version and
+   * validated like 1.1, so they keep mapping to the 1.1 handlers.
+   */
+  static constexpr uint32_t HandlerVersion(uint32_t version) {
+    return (version & 0x00FF0000) == 0
+               ? ProofVersion(1, 1, static_cast<ProofType>(version & 0xFF))
+               : version;
   }
 
  private:
-  const uint16_t kMajor = 1;
-  const uint16_t kMinor = 1;
+  // Size of a compressed curve point
+  static constexpr size_t kPointSize = 32;
+
+  // cleared by ValidateCompactProof for the rest of the call
+  bool emit_details_ = true;
+
+  using Handler = bytesConstRef (ConfidentialValidator::*)(
+      ProofDigest &, const ConfidentialFields &, const ConfidentialUTXO &);
+
+  /**
+   * @brief Proof versions served by the validator, deposits and withdrawals
+   * are transfers with a public value. Major version 2 proofs use the flat
+   * envelope, minor version 2 proofs must carry 32-byte note keys.
+   * Approve proofs of version 1.1 are reported as supported, as they always
+   * were, and are rejected when validated.
+   */
+  static constexpr std::array<ProofHandler<Handler>, 21> Handlers() {
+    return {{
+        {ProofVersion(1, 1, ProofType::kTransfer),
+         &ConfidentialValidator::ValidateTransfer<false>},
+        {ProofVersion(1, 1, ProofType::kMint),
+         &ConfidentialValidator::ValidateMint<false>},
+        {ProofVersion(1, 1, ProofType::kBurn),
+         &ConfidentialValidator::ValidateBurn<false>},
+        {ProofVersion(1, 1, ProofType::kDeposit),
+         &ConfidentialValidator::ValidateTransfer<false>},
+        {ProofVersion(1, 1, ProofType::kWithdraw),
+         &ConfidentialValidator::ValidateTransfer<false>},
+        {ProofVersion(1, 1, ProofType::kApprove),
+         &ConfidentialValidator::ValidateApprove},
+        {ProofVersion(1, 2, ProofType::kTransfer),
+         &ConfidentialValidator::ValidateTransfer<true>},
+        {ProofVersion(1, 2, ProofType::kMint),
+         &ConfidentialValidator::ValidateMint<true>},
+        {ProofVersion(1, 2, ProofType::kBurn),
+         &ConfidentialValidator::ValidateBurn<true>},
+        {ProofVersion(1, 2, ProofType::kDeposit),
+         &ConfidentialValidator::ValidateTransfer<true>},
+        {ProofVersion(1, 2, ProofType::kWithdraw),
+         &ConfidentialValidator::ValidateTransfer<true>},
+        {ProofVersion(2, 1, ProofType::kTransfer),
+         &ConfidentialValidator::ValidateTransfer<false>},
+        {ProofVersion(2, 1, ProofType::kMint),
+         &ConfidentialValidator::ValidateMint<false>},
+        {ProofVersion(2, 1, ProofType::kBurn),
+         &ConfidentialValidator::ValidateBurn<false>},
+        {ProofVersion(2, 1, ProofType::kDeposit),
+         &ConfidentialValidator::ValidateTransfer<false>},
+        {ProofVersion(2, 1, ProofType::kWithdraw),
+         &ConfidentialValidator::ValidateTransfer<false>},
+        {ProofVersion(2, 2, ProofType::kTransfer),
+         &ConfidentialValidator::ValidateTransfer<true>},
+        {ProofVersion(2, 2, ProofType::kMint),
+         &ConfidentialValidator::ValidateMint<true>},
+        {ProofVersion(2, 2, ProofType::kBurn),
+         &ConfidentialValidator::ValidateBurn<true>},
+        {ProofVersion(2, 2, ProofType::kDeposit),
+         &ConfidentialValidator::ValidateTransfer<true>},
+        {ProofVersion(2, 2, ProofType::kWithdraw),
+         &ConfidentialValidator::ValidateTransfer<true>},
+    }};
+  }
 
  private:
   PLATON_EVENT2(ValidatorMigrateEvent, const Address &, const Address &);
 };
 
 PLATON_DISPATCH(ConfidentialValidator,
-                (init)(ValidateProof)(ValidateSignature)(SupportProof)(Migrate))
\ No newline at end of file
+                (init)(ValidateProof)(ValidateCompactProof)(ValidateProofs)(
+                    ValidateSignature)(SupportProof)(Migrate))
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include <platon/platon.h>
+#include <privacy/note_hasher.hpp>
 #include <privacy/plaintext_utxo.h>
+#include <privacy/proof_digest.hpp>
+#include <privacy/proof_envelope.hpp>
+#include <privacy/proof_handler.hpp>
 #include <privacy/validator_interface.hpp>
 #include "platon/call.hpp"
 #include "privacy/debug/gas/stack_helper.h"
@@ -7,8 +11,8 @@
 
 CONTRACT PlaintextValidator : public ValidatorInterface, public Contract {
  public:
-  PLATON_EVENT2(CreateNoteDetailEvent, const h256 &, const bytes &,
-                const bytes &, u128, const bytes &)
+  PLATON_EVENT2(CreateNoteDetailEvent, const h256 &, const bytesConstRef &,
+                const bytesConstRef &, u128, const bytesConstRef &)
  public:
   ACTION void init() {}
   /**
@@ -22,25 +26,42 @@ CONTRACT PlaintextValidator : public ValidatorInterface, public Contract {
    */
   virtual CONST bytesConstRef
   ValidateProof(const bytesConstRef &proof) override {
-    Address spender;
-    PlaintextData plaintext_data;
-    privacy_assert(PreCheck(proof, spender, plaintext_data) == 0,
-                   "precheck failed");
+    return Validate(proof);
+  }
 
-    switch (static_cast<ProofType>(plaintext_data.version & 0x000000FF)) {
-      case ProofType::kTransfer:
-        return ValidateTransfer(spender, plaintext_data);
-      case ProofType::kApprove:
-        return ValidateApprove(spender, plaintext_data);
-      case ProofType::kMint:
-        return ValidateMint(spender, plaintext_data);
-      case ProofType::kBurn:
-        return ValidateBurn(spender, plaintext_data);
-      default:
-        privacy_assert(false, "unknow proof type");
-    }
+  /**
+   * @brief Verify a proof for a token in compact event mode, the result is
+   * the one of ValidateProof but no CreateNoteDetailEvent is emitted
+   *
+   * @param proof Proof byte stream
+   *
+   * @return Return a serialized byte stream of authentication information
+   */
+  CONST bytesConstRef
+  ValidateCompactProof(const bytesConstRef &proof) override {
+    emit_details_ = false;
+    return Validate(proof);
+  }
 
-    return bytesConstRef();
+  /**
+   * @brief Verify several proofs in one call, the call fails as a whole if
+   * any proof is illegal and the revert log carries its batch index
+   *
+   * @param proofs Proof byte streams
+   * @return Serialized authentication information of every proof, in the same
+   * order
+   */
+  CONST std::vector<bytesConstRef> ValidateProofs(
+      const std::vector<bytesConstRef> &proofs) override {
+    std::vector<bytesConstRef> results;
+    results.reserve(proofs.size());
+    for (size_t i = 0; i < proofs.size(); i++) {
+      PrivacyRevert::BatchIndex() = i;
+      results.push_back(Validate(proofs[i]));
+    }
+    PrivacyRevert::BatchIndex() = -1;
+    DEBUG("validate proofs success, proofs:", proofs.size());
+    return results;
   }
 
   /**
@@ -98,14 +119,28 @@ CONTRACT PlaintextValidator : public ValidatorInterface, public Contract {
   }
 
  private:
+  bytesConstRef Validate(const bytesConstRef &proof) {
+    Address spender;
+    PlaintextData plaintext_data;
+    privacy_assert(PreCheck(proof, spender, plaintext_data) == 0,
+                   "precheck failed");
+
+    static_assert(UniqueProofHandlers(Handlers()), "duplicate proof version");
+    Handler handler =
+        FindProofHandler(Handlers(), HandlerVersion(plaintext_data.version));
+    return (this->*handler)(spender, plaintext_data);
+  }
+
+  template <bool kSignerInputs>
   bytesConstRef ValidateTransfer(const Address &spender,
                                  const PlaintextData &plaintext_data) {
     PlaintextUTXO utxo;
-    fetch(RLP(plaintext_data.data), utxo);
+    fetch(RLP(plaintext_data.data.ToBytesConstRef()), utxo);
 
     InputNotes inputs;
     u128 input_total = 0;
-    privacy_assert(CheckInputs(utxo.inputs, inputs, spender, input_total),
+    privacy_assert(CheckInputs(utxo.inputs, inputs, spender, input_total,
+                               kSignerInputs),
                    "checkinput failed");
     DEBUG("check inputs success");
 
@@ -122,20 +157,16 @@ CONTRACT PlaintextValidator : public ValidatorInterface, public Contract {
   bytesConstRef ValidateApprove(const Address &note_owner,
                                 const PlaintextData &plaintext_data) {
     PlaintextApprove approve;
-    fetch(RLP(plaintext_data.data), approve);
+    fetch(RLP(plaintext_data.data.ToBytesConstRef()), approve);
 
     DEBUG("note owner", note_owner.toString(), "approve",
-          Address(approve.owner).toString());
-    privacy_assert(Address(approve.owner) == Address(note_owner),
+          Address(approve.owner.ToBytesConstRef()).toString());
+    privacy_assert(Address(approve.owner.ToBytesConstRef()) == note_owner,
                    "recover address mismatch with note owner");
 
-    RLPStream stream;
-    stream << *reinterpret_cast<const PlaintextNote *>(&approve);
-    h256 hash;
-    ::platon_sha3(stream.out().data(), stream.out().size(), hash.data(),
-                  hash.size);
+    h256 hash = note_hasher_.NoteHash(approve);
     DEBUG("validate approve success:", hash.toString(),
-          "shared_sign:", toHex(approve.shared_sign))
+          "shared_sign:", toHex(approve.shared_sign.ToBytesConstRef()))
 
     return SerializeResultRef(ApproveResult{
         hash,
@@ -146,21 +177,20 @@ CONTRACT PlaintextValidator : public ValidatorInterface, public Contract {
   bytesConstRef ValidateMint(const Address &note_owner,
                              const PlaintextData &plaintext_data) {
     PlaintextMint mint;
-    fetch(RLP(plaintext_data.data), mint);
+    fetch(RLP(plaintext_data.data.ToBytesConstRef()), mint);
     OutputNotes outputs;
     u128 total_mint = 0;
     for (const auto &i : mint.outputs) {
-      privacy_assert(note_owner == Address(i.owner), "illegal note owner");
+      privacy_assert(note_owner == Address(i.owner.ToBytesConstRef()),
+                     "illegal note owner");
       total_mint += i.value;
-      RLPStream stream;
-      stream << *reinterpret_cast<const PlaintextNote *>(&i);
-      h256 hash;
-      platon_sha3(stream.out().data(), stream.out().size(), hash.data(),
-                  hash.size);
-      outputs.push_back(
-          OutputNote{VectorWrapper(i.owner), hash, VectorWrapper(i.meta_data)});
-      PLATON_EMIT_EVENT2(CreateNoteDetailEvent, hash, i.owner, i.owner, i.value,
-                         i.random);
+      h256 hash = note_hasher_.NoteHash(i);
+      outputs.push_back(OutputNote{i.owner, hash, i.meta_data});
+      if (emit_details_) {
+        PLATON_EMIT_EVENT2(CreateNoteDetailEvent, hash,
+                           i.owner.ToBytesConstRef(), i.owner.ToBytesConstRef(),
+                           i.value, i.random.ToBytesConstRef());
+      }
     }
 
     h256 hash;
@@ -171,15 +201,16 @@ CONTRACT PlaintextValidator : public ValidatorInterface, public Contract {
                    bytesConstRef(note_owner.data(), note_owner.size)});
   }
 
-  CONST bytesConstRef ValidateBurn(const Address &note_owner,
-                                   const PlaintextData &plaintext_data) {
+  template <bool kSignerInputs>
+  bytesConstRef ValidateBurn(const Address &note_owner,
+                             const PlaintextData &plaintext_data) {
     PlaintextBurn burn;
-    fetch(RLP(plaintext_data.data), burn);
+    fetch(RLP(plaintext_data.data.ToBytesConstRef()), burn);
     InputNotes input_notes;
     u128 total_burn = 0;
-    privacy_assert(
-        CheckInputs(burn.inputs, input_notes, note_owner, total_burn),
-        "check input notes failed");
+    privacy_assert(CheckInputs(burn.inputs, input_notes, note_owner, total_burn,
+                               kSignerInputs),
+                   "check input notes failed");
 
     h256 hash;
     platon_sha3(plaintext_data.data.data(), plaintext_data.data.size(),
@@ -192,19 +223,36 @@ CONTRACT PlaintextValidator : public ValidatorInterface, public Contract {
 
   int PreCheck(const bytesConstRef &proof, Address &spender,
                PlaintextData &plaintext) {
-    // check signature
-    PlaintextProof plain_proof;
-    fetch(RLP(proof), plain_proof);
+    ProofDigest digest;
+    if (IsFlatProof(proof)) {
+      // the flat fields are the RLP of the proof type data itself
+      FlatProof flat;
+      if (!OpenFlatProof(proof, flat)) {
+        DEBUG("open flat proof failed");
+        return -1;
+      }
+      plaintext.version = flat.version;
+      plaintext.data = flat.fields;
+      digest = ProofDigest(flat.signed_data, flat.signature);
+    } else {
+      PlaintextProof plain_proof;
+      fetch(RLP(proof), plain_proof);
+      fetch(RLP(plain_proof.data.ToBytesConstRef()), plaintext);
+      if (FlatProofVersion(plaintext.version)) {
+        DEBUG("flat proof version in a nested envelope");
+        return -1;
+      }
+      digest = ProofDigest(plain_proof.data.ToBytesConstRef(),
+                           plain_proof.signature.ToBytesConstRef());
+    }
 
-    auto sha3 = platon_sha3(plain_proof.data);
-    if (0 != platon_ecrecover(sha3.data(), plain_proof.signature.data(),
-                              plain_proof.signature.size(), spender.data())) {
+    // check signature
+    spender = digest.Signer();
+    if (spender == Address()) {
       DEBUG("check proof signature failed")
       return -1;
     }
-
     DEBUG("check proof signature success")
-    fetch(RLP(plain_proof.data), plaintext);
 
     if (!MatchVersion(plaintext.version)) {
       DEBUG("check version failed");
@@ -222,47 +270,57 @@ CONTRACT PlaintextValidator : public ValidatorInterface, public Contract {
    * @return true succeeds, false fails
    */
   bool MatchVersion(uint32_t version) {
-    auto major = static_cast<uint8_t>((version & 0x00FF0000) >> 16);
-    auto minor = static_cast<uint8_t>((version & 0x0000FF00) >> 8);
-    auto type = static_cast<ProofType>((version & 0x000000FF));
-    return (kMajor > major ||
-            (major == kMajor && kMinor >= minor && minor > 0)) &&
-           type >= ProofType::kTransfer && type <= ProofType::kApprove;
+    return FindProofHandler(Handlers(), HandlerVersion(version)) != nullptr;
+  }
+
+  /**
+   * @brief Version of the handlers serving a proof. Proofs of major version 0
+   * predate the handler table, they were accepted with any minor version and
+   * validated like 1.1, so they keep mapping to the 1.1 handlers.
+   */
+  static constexpr uint32_t HandlerVersion(uint32_t version) {
+    return (version & 0x00FF0000) == 0
+               ? ProofVersion(1, 1, static_cast<ProofType>(version & 0xFF))
+               : version;
   }
 
+  /**
+   * @brief Verify the inputs and generate input{owner, hash}
+   *
+   * @param inputs Plaintext input notes
+   * @param input_notes Verified input notes
+   * @param spender Signer of the proof
+   * @param input_total Sum of the input values
+   * @param signer_inputs Whether inputs owned by the spender are authorized by
+   * the proof signature, whether they are approved or not, the others are
+   * always checked against their own signature
+   * @return Return true on success, false on failure
+   */
   bool CheckInputs(const std::vector<PlaintextInputNote> &inputs,
                    InputNotes &input_notes, const Address &spender,
-                   u128 &input_total) {
+                   u128 &input_total, bool signer_inputs) {
     input_total = 0;
     for (const auto &i : inputs) {
-      PlaintextInputNote &one_input = const_cast<PlaintextInputNote &>(i);
-      one_input.spender = spender;
-
-      RLPStream stream;
-      stream << *reinterpret_cast<const SpenderNote *>(&i);
-
-      h256 hash;
-      ::platon_sha3(stream.out().data(), stream.out().size(), hash.data(),
-                    hash.size);
-
-      Address result;
-      platon_ecrecover(hash.data(), i.signature.data(), i.signature.size(),
-                       result.data());
-
-      DEBUG("stream:", toHex(stream.out()), "note hash", hash.toString(),
-            "spender", Address(i.spender).toString(), "result",
-            result.toString(), "owner", Address(i.owner).toString());
-      Address owner(i.owner);
-      if (result == owner) {
-        stream.clear();
-        stream << *reinterpret_cast<const PlaintextNote *>(&i);
-        h256 hash;
-        ::platon_sha3(stream.out().data(), stream.out().size(), hash.data(),
-                      hash.size);
-        input_notes.push_back(InputNote{VectorWrapper(i.owner), hash});
+      Address owner(i.owner.ToBytesConstRef());
+      h256 note_hash;
+      if (signer_inputs && owner == spender) {
+        note_hash = note_hasher_.NoteHash(i);
       } else {
-        return false;
+        h256 spender_hash;
+        note_hasher_.SpendHashes(i, spender, spender_hash, note_hash);
+
+        Address result;
+        platon_ecrecover(spender_hash.data(), i.signature.data(),
+                         i.signature.size(), result.data());
+
+        DEBUG("spender note hash", spender_hash.toString(), "spender",
+              spender.toString(), "result", result.toString(), "owner",
+              owner.toString());
+        if (result != owner) {
+          return false;
+        }
       }
+      input_notes.push_back(InputNote{i.owner, note_hash});
       input_total += i.value;
     }
     return true;
@@ -282,18 +340,15 @@ CONTRACT PlaintextValidator : public ValidatorInterface, public Contract {
 
     for (const auto &i : utxo.outputs) {
       output_total += i.value;
-      RLPStream stream;
-      stream << *reinterpret_cast<const PlaintextNote *>(&i);
-      h256 hash;
-      platon_sha3(stream.out().data(), stream.out().size(), hash.data(),
-                  hash.size);
-      DEBUG("create outputs note", toHex(stream.out()),
-            "hash:", hash.toString());
-
-      outputs.push_back(
-          OutputNote{VectorWrapper(i.owner), hash, VectorWrapper(i.meta_data)});
-      PLATON_EMIT_EVENT2(CreateNoteDetailEvent, hash, i.owner, i.owner, i.value,
-                         i.random);
+      h256 hash = note_hasher_.NoteHash(i);
+      DEBUG("create outputs note hash:", hash.toString());
+
+      outputs.push_back(OutputNote{i.owner, hash, i.meta_data});
+      if (emit_details_) {
+        PLATON_EMIT_EVENT2(CreateNoteDetailEvent, hash,
+                           i.owner.ToBytesConstRef(), i.owner.ToBytesConstRef(),
+                           i.value, i.random.ToBytesConstRef());
+      }
     }
 
     if (utxo.public_value < 0) {
@@ -314,12 +369,55 @@ CONTRACT PlaintextValidator : public ValidatorInterface, public Contract {
   }
 
  private:
-  const uint16_t kMajor = 1;
-  const uint16_t kMinor = 1;
+  using Handler = bytesConstRef (PlaintextValidator::*)(const Address &,
+                                                        const PlaintextData &);
+
+  /**
+   * @brief Proof versions served by the validator. From minor version 2 on the
+   * proof signature authorizes the inputs owned by the proof signer, approved
+   * or not: an approval lets another spender sign for a note but never takes
+   * the right to spend it from its owner, who under 1.1 can sign the spender
+   * note for itself. Inputs of other owners, which includes an approved note
+   * spent by its spender, keep their per-input signature. Major version 2
+   * proofs use the flat envelope and keep that rule.
+   */
+  static constexpr std::array<ProofHandler<Handler>, 12> Handlers() {
+    return {{
+        {ProofVersion(1, 1, ProofType::kTransfer),
+         &PlaintextValidator::ValidateTransfer<false>},
+        {ProofVersion(1, 1, ProofType::kMint),
+         &PlaintextValidator::ValidateMint},
+        {ProofVersion(1, 1, ProofType::kBurn),
+         &PlaintextValidator::ValidateBurn<false>},
+        {ProofVersion(1, 1, ProofType::kApprove),
+         &PlaintextValidator::ValidateApprove},
+        {ProofVersion(1, 2, ProofType::kTransfer),
+         &PlaintextValidator::ValidateTransfer<true>},
+        {ProofVersion(1, 2, ProofType::kMint),
+         &PlaintextValidator::ValidateMint},
+        {ProofVersion(1, 2, ProofType::kBurn),
+         &PlaintextValidator::ValidateBurn<true>},
+        {ProofVersion(1, 2, ProofType::kApprove),
+         &PlaintextValidator::ValidateApprove},
+        {ProofVersion(2, 1, ProofType::kTransfer),
+         &PlaintextValidator::ValidateTransfer<true>},
+        {ProofVersion(2, 1, ProofType::kMint),
+         &PlaintextValidator::ValidateMint},
+        {ProofVersion(2, 1, ProofType::kBurn),
+         &PlaintextValidator::ValidateBurn<true>},
+        {ProofVersion(2, 1, ProofType::kApprove),
+         &PlaintextValidator::ValidateApprove},
+    }};
+  }
+
+  NoteHasher note_hasher_;
+  // cleared by ValidateCompactProof for the rest of the call
+  bool emit_details_ = true;
 
  private:
   PLATON_EVENT2(ValidatorMigrateEvent, const Address &, const Address &);
 };
 
 PLATON_DISPATCH(PlaintextValidator,
-                (init)(ValidateProof)(ValidateSignature)(SupportProof)(Migrate))
\ No newline at end of file
+                (init)(ValidateProof)(ValidateCompactProof)(ValidateProofs)(
+                    ValidateSignature)(SupportProof)(Migrate))
\ No newline at end of file
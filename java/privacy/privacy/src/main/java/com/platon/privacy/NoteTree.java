@@ -0,0 +1,91 @@
+package com.platon.privacy;
+
+import com.alaya.crypto.Hash;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Off chain copy of the note tree of a storage created with the kNoteTree option. The storage
+ * only keeps the frontier of the tree, the leaves are taken from its NoteTreeEvent, which
+ * publishes the first leaf index and the note hashes of every update in creation order.
+ */
+public class NoteTree {
+    public static final int DEPTH = 32;
+    private static final byte[][] zeros = new byte[DEPTH + 1][];
+
+    static {
+        zeros[0] = new byte[32];
+        for (int i = 0; i < DEPTH; i++) {
+            zeros[i + 1] = hash(zeros[i], zeros[i]);
+        }
+    }
+
+    private final List<byte[]> leaves = new ArrayList<>();
+
+    public long size() {
+        return leaves.size();
+    }
+
+    public void add(byte[] leaf) {
+        leaves.add(leaf);
+    }
+
+    /** Add the leaves of a NoteTreeEvent, they have to follow the leaves already added. */
+    public void add(long first, byte[][] leaves) {
+        if (first != size()) {
+            throw new IllegalArgumentException("leaves do not follow the tree, first=" + first);
+        }
+        this.leaves.addAll(Arrays.asList(leaves));
+    }
+
+    public byte[] root() {
+        List<byte[]> level = leaves;
+        for (int i = 0; i < DEPTH; i++) {
+            level = parents(level, i);
+        }
+        return level.isEmpty() ? zeros[DEPTH] : level.get(0);
+    }
+
+    /** Sibling hashes from the leaf level to the root. */
+    public byte[][] path(long index) {
+        if (index < 0 || index >= size()) {
+            throw new IndexOutOfBoundsException("note index out of range: " + index);
+        }
+        byte[][] siblings = new byte[DEPTH][];
+        List<byte[]> level = leaves;
+        int position = (int) index;
+        for (int i = 0; i < DEPTH; i++) {
+            int sibling = position ^ 1;
+            siblings[i] = sibling < level.size() ? level.get(sibling) : zeros[i];
+            level = parents(level, i);
+            position >>= 1;
+        }
+        return siblings;
+    }
+
+    public static boolean verify(byte[] leaf, long index, byte[][] siblings, byte[] root) {
+        byte[] node = leaf;
+        for (int i = 0; i < siblings.length; i++) {
+            node = ((index >> i) & 1) == 0 ? hash(node, siblings[i]) : hash(siblings[i], node);
+        }
+        return Arrays.equals(node, root);
+    }
+
+    private static List<byte[]> parents(List<byte[]> level, int height) {
+        List<byte[]> parents = new ArrayList<>((level.size() + 1) / 2);
+        for (int i = 0; i < level.size(); i += 2) {
+            byte[] right = i + 1 < level.size() ? level.get(i + 1) : zeros[height];
+            parents.add(hash(level.get(i), right));
+        }
+        return parents;
+    }
+
+    private static byte[] hash(byte[] left, byte[] right) {
+        byte[] input = new byte[left.length + right.length];
+        System.arraycopy(left, 0, input, 0, left.length);
+        System.arraycopy(right, 0, input, left.length, right.length);
+        return Hash.sha3(input);
+    }
+}
@@ -8,8 +8,10 @@ import com.alaya.rlp.wasm.datatypes.Uint32;
 import com.alaya.rlp.wasm.datatypes.Uint64;
 import com.alaya.rlp.wasm.datatypes.WasmAddress;
 import com.google.common.primitives.Bytes;
+import com.google.common.primitives.Ints;
 
 import java.math.BigInteger;
+import java.util.Arrays;
 import java.util.LinkedList;
 import java.util.List;
 
@@ -21,6 +23,11 @@ public class Confidential {
 
     public static long minorUpdateVersion = name + major + (2 << 8);
     public static long majorUpdateVersion = name + (2 << 16) + minor;
+    // Proofs of this version use the flat envelope | version(4) | fields | signature(65) |
+    public static long flatVersion = name + (2 << 16) + minor;
+    // Proofs of this version must carry 32-byte ephemeralPk and signPk, their notes keep the RLP
+    // owner of the older versions
+    public static long fixedPointsVersion = name + major + (2 << 8);
 
     static {
         System.out.println(minorUpdateVersion);
@@ -450,6 +457,52 @@ public class Confidential {
         public byte[] oldBurnHash; // last burn hash
     }
 
+    public static class TransferFields {
+        public byte[] confidentialTx;
+        public WasmAddress publicOwner;
+        public byte[] depositSignature;
+        public List<byte[]> metaData;
+
+        public TransferFields(byte[] confidentialTx, TransferExtra extra) {
+            this.confidentialTx = confidentialTx;
+            this.publicOwner = extra.publicOwner;
+            this.depositSignature = extra.depositSignature;
+            this.metaData = extra.metaData;
+        }
+    }
+
+    public static class MintFields {
+        public byte[] confidentialTx;
+        public byte[] oldMintHash;
+        public List<byte[]> metaData;
+
+        public MintFields(byte[] confidentialTx, MintExtra extra) {
+            this.confidentialTx = confidentialTx;
+            this.oldMintHash = extra.oldMintHash;
+            this.metaData = extra.metaData;
+        }
+    }
+
+    public static class BurnFields {
+        public byte[] confidentialTx;
+        public byte[] oldBurnHash;
+
+        public BurnFields(byte[] confidentialTx, BurnExtra extra) {
+            this.confidentialTx = confidentialTx;
+            this.oldBurnHash = extra.oldBurnHash;
+        }
+    }
+
+    /**
+     * Flat proof of a TransferFields, MintFields or BurnFields, it is passed to the contract as
+     * is instead of RLP encoding a ConfidentialProof.
+     */
+    public static byte[] createFlatProof(int type, Object fields, Credentials sender) {
+        byte[] signedData =
+                Bytes.concat(Ints.toByteArray((int) (flatVersion + type)), RLPCodec.encode(fields));
+        return Bytes.concat(signedData, new ConfidentialProof().signature(signedData, sender));
+    }
+
     public static class ConfidentialData {
         public Uint32 version;
         public byte[] confidentialTx;
@@ -482,8 +535,26 @@ public class Confidential {
     }
 
     public static class EncryptedOwner {
+        public static final int POINT_SIZE = 32;
+
         public byte[] ephemeralPk;
         public byte[] signPk;
+
+        /**
+         * Decode the owner of a note. Contracts store and publish the 68-byte RLP encoded owner,
+         * the 64-byte compact owner, ephemeralPk followed by signPk, is only found in the events
+         * of a validator that gave it to minor version 2 proofs.
+         */
+        public static EncryptedOwner decode(byte[] owner) {
+            if (owner.length == 2 * POINT_SIZE) {
+                EncryptedOwner result = new EncryptedOwner();
+                result.ephemeralPk = Arrays.copyOfRange(owner, 0, POINT_SIZE);
+                result.signPk = Arrays.copyOfRange(owner, POINT_SIZE, 2 * POINT_SIZE);
+                return result;
+            }
+            return RLPCodec.decode(
+                    owner, EncryptedOwner.class, NetworkParameters.CurrentNetwork.getChainId());
+        }
     }
 
     public static class PlainValue {
@@ -124,6 +124,25 @@ public class ConfidentialTxJNA {
         return false;
     }
 
+    /**
+     * Is the owner of note, the owner is the note owner published by the contract, see
+     * Confidential.EncryptedOwner.decode. The points are passed on compressed, the library
+     * decompresses them.
+     */
+    public static boolean is_note_owner(byte[] owner, byte[] spend_pk, byte[] view_sk)
+            throws Exception {
+        Confidential.EncryptedOwner encryptedOwner = Confidential.EncryptedOwner.decode(owner);
+        return is_note_owner(
+                encryptedOwner.ephemeralPk,
+                encryptedOwner.ephemeralPk.length,
+                encryptedOwner.signPk,
+                encryptedOwner.signPk.length,
+                spend_pk,
+                spend_pk.length,
+                view_sk,
+                view_sk.length);
+    }
+
     /**
      * Decrypt the quatity and blinding.
      *
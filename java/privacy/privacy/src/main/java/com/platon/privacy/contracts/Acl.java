@@ -88,6 +88,16 @@ public class Acl extends WasmContract {
 
     public static final String FUNC_UPDATESTORAGE = "UpdateStorage";
 
+    public static final String FUNC_CREATEREGISTRYWITHOPTIONS = "CreateRegistryWithOptions";
+
+    public static final String FUNC_GETNOTES = "GetNotes";
+
+    public static final String FUNC_GETSTORAGESHARDS = "GetStorageShards";
+
+    public static final String FUNC_VALIDATEPROOFS = "ValidateProofs";
+
+    public static final String FUNC_SETCOMPACTEVENTS = "SetCompactEvents";
+
     public static final WasmEvent ACLMIGRATEEVENT_EVENT = new WasmEvent("AclMigrateEvent", Arrays.asList(new WasmEventParameter(WasmAddress.class, true) , new WasmEventParameter(WasmAddress.class, true)), Arrays.asList());
     ;
 
@@ -109,6 +119,9 @@ public class Acl extends WasmContract {
     public static final WasmEvent CREATEREGISTRYNOTE_EVENT = new WasmEvent("CreateRegistryNote", Arrays.asList(new WasmEventParameter(WasmAddress.class, true)), Arrays.asList(new WasmEventParameter(WasmAddress.class) , new WasmEventParameter(WasmAddress.class) , new WasmEventParameter(WasmAddress.class)));
     ;
 
+    public static final WasmEvent CREATESHAREDVALIDATOR_EVENT = new WasmEvent("CreateSharedValidator", Arrays.asList(new WasmEventParameter(Uint32.class, true)), Arrays.asList(new WasmEventParameter(WasmAddress.class)));
+    ;
+
     protected Acl(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
         super(BINARY, contractAddress, web3j, credentials, contractGasProvider, chainId);
     }
@@ -117,6 +130,39 @@ public class Acl extends WasmContract {
         super(BINARY, contractAddress, web3j, transactionManager, contractGasProvider, chainId);
     }
 
+    public List<CreateSharedValidatorEventResponse> getCreateSharedValidatorEvents(TransactionReceipt transactionReceipt) {
+        List<WasmContract.WasmEventValuesWithLog> valueList = extractEventParametersWithLog(CREATESHAREDVALIDATOR_EVENT, transactionReceipt);
+        ArrayList<CreateSharedValidatorEventResponse> responses = new ArrayList<CreateSharedValidatorEventResponse>(valueList.size());
+        for (WasmContract.WasmEventValuesWithLog eventValues : valueList) {
+            CreateSharedValidatorEventResponse typedResponse = new CreateSharedValidatorEventResponse();
+            typedResponse.log = eventValues.getLog();
+            typedResponse.topic = (String) eventValues.getIndexedValues().get(0);
+            typedResponse.arg1 = (WasmAddress) eventValues.getNonIndexedValues().get(0);
+            responses.add(typedResponse);
+        }
+        return responses;
+    }
+
+    public Observable<CreateSharedValidatorEventResponse> createSharedValidatorEventObservable(PlatonFilter filter) {
+        return web3j.platonLogObservable(filter).map(new Func1<Log, CreateSharedValidatorEventResponse>() {
+            @Override
+            public CreateSharedValidatorEventResponse call(Log log) {
+                WasmContract.WasmEventValuesWithLog eventValues = extractEventParametersWithLog(CREATESHAREDVALIDATOR_EVENT, log);
+                CreateSharedValidatorEventResponse typedResponse = new CreateSharedValidatorEventResponse();
+                typedResponse.log = log;
+                typedResponse.topic = (String) eventValues.getIndexedValues().get(0);
+                typedResponse.arg1 = (WasmAddress) eventValues.getNonIndexedValues().get(0);
+                return typedResponse;
+            }
+        });
+    }
+
+    public Observable<CreateSharedValidatorEventResponse> createSharedValidatorEventObservable(DefaultBlockParameter startBlock, DefaultBlockParameter endBlock) {
+        PlatonFilter filter = new PlatonFilter(startBlock, endBlock, getContractAddress());
+        filter.addSingleTopic(WasmEventEncoder.encode(CREATESHAREDVALIDATOR_EVENT));
+        return createSharedValidatorEventObservable(filter);
+    }
+
     public static RemoteCall<Acl> deploy(Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId, WasmAddress registry_address, WasmAddress token_manager) {
         String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList(registry_address,token_manager));
         return deployRemoteCall(Acl.class, web3j, credentials, contractGasProvider, encodedConstructor, chainId);
@@ -553,6 +599,41 @@ public class Acl extends WasmContract {
         return executeRemoteCallTransaction(function, vonValue);
     }
 
+    public RemoteCall<TransactionReceipt> CreateRegistryWithOptions(Uint32 validator_version, Uint32 storage_version, Uint128 scaling_factor, WasmAddress token_address, Boolean can_mint_burn, RegistryOptions options) {
+        final WasmFunction function = new WasmFunction(FUNC_CREATEREGISTRYWITHOPTIONS, Arrays.asList(validator_version,storage_version,scaling_factor,token_address,can_mint_burn,options), Void.class);
+        return executeRemoteCallTransaction(function);
+    }
+
+    public RemoteCall<TransactionReceipt> CreateRegistryWithOptions(Uint32 validator_version, Uint32 storage_version, Uint128 scaling_factor, WasmAddress token_address, Boolean can_mint_burn, RegistryOptions options, BigInteger vonValue) {
+        final WasmFunction function = new WasmFunction(FUNC_CREATEREGISTRYWITHOPTIONS, Arrays.asList(validator_version,storage_version,scaling_factor,token_address,can_mint_burn,options), Void.class);
+        return executeRemoteCallTransaction(function, vonValue);
+    }
+
+    public RemoteCall<NoteStatus[]> GetNotes(byte[][] note_hashes) {
+        final WasmFunction function = new WasmFunction(FUNC_GETNOTES, Arrays.asList(note_hashes, Void.class), NoteStatus[].class);
+        return executeRemoteCall(function, NoteStatus[].class);
+    }
+
+    public RemoteCall<WasmAddress[]> GetStorageShards(WasmAddress addr) {
+        final WasmFunction function = new WasmFunction(FUNC_GETSTORAGESHARDS, Arrays.asList(addr), WasmAddress[].class);
+        return executeRemoteCall(function, WasmAddress[].class);
+    }
+
+    public RemoteCall<byte[][]> ValidateProofs(byte[][] proofs) {
+        final WasmFunction function = new WasmFunction(FUNC_VALIDATEPROOFS, Arrays.asList(proofs, Void.class), byte[][].class);
+        return executeRemoteCall(function, byte[][].class);
+    }
+
+    public RemoteCall<TransactionReceipt> SetCompactEvents(Boolean compact) {
+        final WasmFunction function = new WasmFunction(FUNC_SETCOMPACTEVENTS, Arrays.asList(compact), Void.class);
+        return executeRemoteCallTransaction(function);
+    }
+
+    public RemoteCall<TransactionReceipt> SetCompactEvents(Boolean compact, BigInteger vonValue) {
+        final WasmFunction function = new WasmFunction(FUNC_SETCOMPACTEVENTS, Arrays.asList(compact), Void.class);
+        return executeRemoteCallTransaction(function, vonValue);
+    }
+
     public static Acl load(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
         return new Acl(contractAddress, web3j, credentials, contractGasProvider, chainId);
     }
@@ -627,6 +708,14 @@ public class Acl extends WasmContract {
         public WasmAddress arg3;
     }
 
+    public static class CreateSharedValidatorEventResponse {
+        public Log log;
+
+        public String topic;
+
+        public WasmAddress arg1;
+    }
+
     public static class TokenRegistry {
         public WasmAddress token_addr;
 
@@ -660,4 +749,12 @@ public class Acl extends WasmContract {
 
         public byte[] sender;
     }
+
+    public static class RegistryOptions {
+        public Uint32 storage_options;
+
+        public Uint8 storage_shards;
+
+        public Boolean shared_validator;
+    }
 }
@@ -13,6 +13,8 @@ import com.alaya.protocol.core.methods.request.PlatonFilter;
 import com.alaya.protocol.core.methods.response.Log;
 import com.alaya.protocol.core.methods.response.TransactionReceipt;
 import com.alaya.rlp.wasm.datatypes.Uint128;
+import com.alaya.rlp.wasm.datatypes.Uint32;
+import com.alaya.rlp.wasm.datatypes.Uint64;
 import com.alaya.rlp.wasm.datatypes.WasmAddress;
 import com.alaya.tx.TransactionManager;
 import com.alaya.tx.WasmContract;
@@ -54,6 +56,22 @@ public class Confidential_storage extends WasmContract {
 
     public static final String FUNC_MIGRATE = "Migrate";
 
+    public static final String FUNC_UPDATENOTESBATCH = "UpdateNotesBatch";
+
+    public static final String FUNC_CREATEREGISTRYWITHOPTIONS = "CreateRegistryWithOptions";
+
+    public static final String FUNC_GETNOTES = "GetNotes";
+
+    public static final String FUNC_NOTEROOT = "NoteRoot";
+
+    public static final String FUNC_INHERIT = "Inherit";
+
+    public static final String FUNC_DRAINOLDSTORAGE = "DrainOldStorage";
+
+    public static final String FUNC_EXPORTNOTES = "ExportNotes";
+
+    public static final String FUNC_GETSTATS = "GetStats";
+
     public static final WasmEvent PRIVACYREVERTEVENT_EVENT = new WasmEvent("PrivacyRevertEvent", Arrays.asList(), Arrays.asList(new WasmEventParameter(String.class)));
     ;
 
@@ -66,6 +84,9 @@ public class Confidential_storage extends WasmContract {
     public static final WasmEvent STORAGEMIGRATEEVENT_EVENT = new WasmEvent("StorageMigrateEvent", Arrays.asList(new WasmEventParameter(WasmAddress.class, true) , new WasmEventParameter(WasmAddress.class, true)), Arrays.asList());
     ;
 
+    public static final WasmEvent NOTETREEEVENT_EVENT = new WasmEvent("NoteTreeEvent", Arrays.asList(), Arrays.asList(new WasmEventParameter(Uint64.class) , new WasmEventParameter(byte[][].class)));
+    ;
+
     protected Confidential_storage(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
         super(BINARY, contractAddress, web3j, credentials, contractGasProvider, chainId);
     }
@@ -208,6 +229,39 @@ public class Confidential_storage extends WasmContract {
         return storageMigrateEventEventObservable(filter);
     }
 
+    public List<NoteTreeEventEventResponse> getNoteTreeEventEvents(TransactionReceipt transactionReceipt) {
+        List<WasmContract.WasmEventValuesWithLog> valueList = extractEventParametersWithLog(NOTETREEEVENT_EVENT, transactionReceipt);
+        ArrayList<NoteTreeEventEventResponse> responses = new ArrayList<NoteTreeEventEventResponse>(valueList.size());
+        for (WasmContract.WasmEventValuesWithLog eventValues : valueList) {
+            NoteTreeEventEventResponse typedResponse = new NoteTreeEventEventResponse();
+            typedResponse.log = eventValues.getLog();
+            typedResponse.arg1 = (Uint64) eventValues.getNonIndexedValues().get(0);
+            typedResponse.arg2 = (byte[][]) eventValues.getNonIndexedValues().get(1);
+            responses.add(typedResponse);
+        }
+        return responses;
+    }
+
+    public Observable<NoteTreeEventEventResponse> noteTreeEventEventObservable(PlatonFilter filter) {
+        return web3j.platonLogObservable(filter).map(new Func1<Log, NoteTreeEventEventResponse>() {
+            @Override
+            public NoteTreeEventEventResponse call(Log log) {
+                WasmContract.WasmEventValuesWithLog eventValues = extractEventParametersWithLog(NOTETREEEVENT_EVENT, log);
+                NoteTreeEventEventResponse typedResponse = new NoteTreeEventEventResponse();
+                typedResponse.log = log;
+                typedResponse.arg1 = (Uint64) eventValues.getNonIndexedValues().get(0);
+                typedResponse.arg2 = (byte[][]) eventValues.getNonIndexedValues().get(1);
+                return typedResponse;
+            }
+        });
+    }
+
+    public Observable<NoteTreeEventEventResponse> noteTreeEventEventObservable(DefaultBlockParameter startBlock, DefaultBlockParameter endBlock) {
+        PlatonFilter filter = new PlatonFilter(startBlock, endBlock, getContractAddress());
+        filter.addSingleTopic(WasmEventEncoder.encode(NOTETREEEVENT_EVENT));
+        return noteTreeEventEventObservable(filter);
+    }
+
     public static RemoteCall<Confidential_storage> deploy(Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
         String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList());
         return deployRemoteCall(Confidential_storage.class, web3j, credentials, contractGasProvider, encodedConstructor, chainId);
@@ -298,6 +352,66 @@ public class Confidential_storage extends WasmContract {
         return executeRemoteCallTransaction(function, vonValue);
     }
 
+    public RemoteCall<TransactionReceipt> UpdateNotesBatch(byte[] proof_results) {
+        final WasmFunction function = new WasmFunction(FUNC_UPDATENOTESBATCH, Arrays.asList(proof_results, Void.class), Void.class);
+        return executeRemoteCallTransaction(function);
+    }
+
+    public RemoteCall<TransactionReceipt> UpdateNotesBatch(byte[] proof_results, BigInteger vonValue) {
+        final WasmFunction function = new WasmFunction(FUNC_UPDATENOTESBATCH, Arrays.asList(proof_results, Void.class), Void.class);
+        return executeRemoteCallTransaction(function, vonValue);
+    }
+
+    public RemoteCall<TransactionReceipt> CreateRegistryWithOptions(Boolean can_mint_burn, Uint32 options) {
+        final WasmFunction function = new WasmFunction(FUNC_CREATEREGISTRYWITHOPTIONS, Arrays.asList(can_mint_burn,options), Void.class);
+        return executeRemoteCallTransaction(function);
+    }
+
+    public RemoteCall<TransactionReceipt> CreateRegistryWithOptions(Boolean can_mint_burn, Uint32 options, BigInteger vonValue) {
+        final WasmFunction function = new WasmFunction(FUNC_CREATEREGISTRYWITHOPTIONS, Arrays.asList(can_mint_burn,options), Void.class);
+        return executeRemoteCallTransaction(function, vonValue);
+    }
+
+    public RemoteCall<NoteStatus[]> GetNotes(byte[][] hashes) {
+        final WasmFunction function = new WasmFunction(FUNC_GETNOTES, Arrays.asList(hashes, Void.class), NoteStatus[].class);
+        return executeRemoteCall(function, NoteStatus[].class);
+    }
+
+    public RemoteCall<byte[]> NoteRoot() {
+        final WasmFunction function = new WasmFunction(FUNC_NOTEROOT, Arrays.asList(), byte[].class);
+        return executeRemoteCall(function, byte[].class);
+    }
+
+    public RemoteCall<TransactionReceipt> Inherit(Boolean can_mint_burn, Uint32 options) {
+        final WasmFunction function = new WasmFunction(FUNC_INHERIT, Arrays.asList(can_mint_burn,options), Void.class);
+        return executeRemoteCallTransaction(function);
+    }
+
+    public RemoteCall<TransactionReceipt> Inherit(Boolean can_mint_burn, Uint32 options, BigInteger vonValue) {
+        final WasmFunction function = new WasmFunction(FUNC_INHERIT, Arrays.asList(can_mint_burn,options), Void.class);
+        return executeRemoteCallTransaction(function, vonValue);
+    }
+
+    public RemoteCall<TransactionReceipt> DrainOldStorage(Uint32 limit) {
+        final WasmFunction function = new WasmFunction(FUNC_DRAINOLDSTORAGE, Arrays.asList(limit), Void.class);
+        return executeRemoteCallTransaction(function);
+    }
+
+    public RemoteCall<TransactionReceipt> DrainOldStorage(Uint32 limit, BigInteger vonValue) {
+        final WasmFunction function = new WasmFunction(FUNC_DRAINOLDSTORAGE, Arrays.asList(limit), Void.class);
+        return executeRemoteCallTransaction(function, vonValue);
+    }
+
+    public RemoteCall<NoteExport> ExportNotes(byte[] cursor, Uint32 limit) {
+        final WasmFunction function = new WasmFunction(FUNC_EXPORTNOTES, Arrays.asList(cursor,limit), NoteExport.class);
+        return executeRemoteCall(function, NoteExport.class);
+    }
+
+    public RemoteCall<StorageStats> GetStats() {
+        final WasmFunction function = new WasmFunction(FUNC_GETSTATS, Arrays.asList(), StorageStats.class);
+        return executeRemoteCall(function, StorageStats.class);
+    }
+
     public static Confidential_storage load(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
         return new Confidential_storage(contractAddress, web3j, credentials, contractGasProvider, chainId);
     }
@@ -340,6 +454,14 @@ public class Confidential_storage extends WasmContract {
         public String topic2;
     }
 
+    public static class NoteTreeEventEventResponse {
+        public Log log;
+
+        public Uint64 arg1;
+
+        public byte[][] arg2;
+    }
+
     public static class NoteStatus {
         public byte[] owner;
 
@@ -347,4 +469,24 @@ public class Confidential_storage extends WasmContract {
 
         public byte[] sender;
     }
+
+    public static class NoteExport {
+        public NoteStatus[] notes;
+
+        public byte[] cursor;
+
+        public Uint64 version;
+    }
+
+    public static class StorageStats {
+        public Uint64 live_notes;
+
+        public Uint64 created_notes;
+
+        public Uint64 destroyed_notes;
+
+        public Uint64 state_bytes;
+
+        public Uint64 approvals;
+    }
 }
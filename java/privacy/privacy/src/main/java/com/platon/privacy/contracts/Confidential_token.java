@@ -67,6 +67,12 @@ public class Confidential_token extends WasmContract {
 
     public static final String FUNC_MINT = "Mint";
 
+    public static final String FUNC_GETNOTES = "GetNotes";
+
+    public static final String FUNC_SETCOMPACTEVENTS = "SetCompactEvents";
+
+    public static final String FUNC_COMPACTEVENTS = "CompactEvents";
+
     public static final WasmEvent PRIVACYREVERTEVENT_EVENT = new WasmEvent("PrivacyRevertEvent", Arrays.asList(), Arrays.asList(new WasmEventParameter(String.class)));
     ;
 
@@ -94,6 +100,9 @@ public class Confidential_token extends WasmContract {
     public static final WasmEvent MINTEVENT_EVENT = new WasmEvent("MintEvent", Arrays.asList(), Arrays.asList(new WasmEventParameter(byte[].class) , new WasmEventParameter(Uint128.class)));
     ;
 
+    public static final WasmEvent NOTECHANGEEVENT_EVENT = new WasmEvent("NoteChangeEvent", Arrays.asList(), Arrays.asList(new WasmEventParameter(OutputNotes[].class) , new WasmEventParameter(byte[][].class)));
+    ;
+
     protected Confidential_token(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
         super(BINARY, contractAddress, web3j, credentials, contractGasProvider, chainId);
     }
@@ -510,6 +519,39 @@ public class Confidential_token extends WasmContract {
         return mintEventEventObservable(filter);
     }
 
+    public List<NoteChangeEventEventResponse> getNoteChangeEventEvents(TransactionReceipt transactionReceipt) {
+        List<WasmContract.WasmEventValuesWithLog> valueList = extractEventParametersWithLog(NOTECHANGEEVENT_EVENT, transactionReceipt);
+        ArrayList<NoteChangeEventEventResponse> responses = new ArrayList<NoteChangeEventEventResponse>(valueList.size());
+        for (WasmContract.WasmEventValuesWithLog eventValues : valueList) {
+            NoteChangeEventEventResponse typedResponse = new NoteChangeEventEventResponse();
+            typedResponse.log = eventValues.getLog();
+            typedResponse.arg1 = (OutputNotes[]) eventValues.getNonIndexedValues().get(0);
+            typedResponse.arg2 = (byte[][]) eventValues.getNonIndexedValues().get(1);
+            responses.add(typedResponse);
+        }
+        return responses;
+    }
+
+    public Observable<NoteChangeEventEventResponse> noteChangeEventEventObservable(PlatonFilter filter) {
+        return web3j.platonLogObservable(filter).map(new Func1<Log, NoteChangeEventEventResponse>() {
+            @Override
+            public NoteChangeEventEventResponse call(Log log) {
+                WasmContract.WasmEventValuesWithLog eventValues = extractEventParametersWithLog(NOTECHANGEEVENT_EVENT, log);
+                NoteChangeEventEventResponse typedResponse = new NoteChangeEventEventResponse();
+                typedResponse.log = log;
+                typedResponse.arg1 = (OutputNotes[]) eventValues.getNonIndexedValues().get(0);
+                typedResponse.arg2 = (byte[][]) eventValues.getNonIndexedValues().get(1);
+                return typedResponse;
+            }
+        });
+    }
+
+    public Observable<NoteChangeEventEventResponse> noteChangeEventEventObservable(DefaultBlockParameter startBlock, DefaultBlockParameter endBlock) {
+        PlatonFilter filter = new PlatonFilter(startBlock, endBlock, getContractAddress());
+        filter.addSingleTopic(WasmEventEncoder.encode(NOTECHANGEEVENT_EVENT));
+        return noteChangeEventEventObservable(filter);
+    }
+
     public static RemoteCall<Confidential_token> deploy(Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId, String name, String symbol, WasmAddress registry_address, Uint32 validator_version, Uint32 storage_version, Uint128 scaling_factor, WasmAddress token_address) {
         String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList(name,symbol,registry_address,validator_version,storage_version,scaling_factor,token_address));
         return deployRemoteCall(Confidential_token.class, web3j, credentials, contractGasProvider, encodedConstructor, chainId);
@@ -530,6 +572,26 @@ public class Confidential_token extends WasmContract {
         return deployRemoteCall(Confidential_token.class, web3j, transactionManager, contractGasProvider, encodedConstructor, initialVonValue, chainId);
     }
 
+    public RemoteCall<NoteStatus[]> GetNotes(byte[][] note_hashes) {
+        final WasmFunction function = new WasmFunction(FUNC_GETNOTES, Arrays.asList(note_hashes, Void.class), NoteStatus[].class);
+        return executeRemoteCall(function, NoteStatus[].class);
+    }
+
+    public RemoteCall<TransactionReceipt> SetCompactEvents(Boolean compact) {
+        final WasmFunction function = new WasmFunction(FUNC_SETCOMPACTEVENTS, Arrays.asList(compact), Void.class);
+        return executeRemoteCallTransaction(function);
+    }
+
+    public RemoteCall<TransactionReceipt> SetCompactEvents(Boolean compact, BigInteger vonValue) {
+        final WasmFunction function = new WasmFunction(FUNC_SETCOMPACTEVENTS, Arrays.asList(compact), Void.class);
+        return executeRemoteCallTransaction(function, vonValue);
+    }
+
+    public RemoteCall<Boolean> CompactEvents() {
+        final WasmFunction function = new WasmFunction(FUNC_COMPACTEVENTS, Arrays.asList(), Boolean.class);
+        return executeRemoteCall(function, Boolean.class);
+    }
+
     public static Confidential_token load(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
         return new Confidential_token(contractAddress, web3j, credentials, contractGasProvider, chainId);
     }
@@ -615,4 +677,28 @@ public class Confidential_token extends WasmContract {
 
         public Uint128 arg2;
     }
+
+    public static class NoteChangeEventEventResponse {
+        public Log log;
+
+        public OutputNotes[] arg1;
+
+        public byte[][] arg2;
+    }
+
+    public static class NoteStatus {
+        public byte[] owner;
+
+        public byte[] hash;
+
+        public byte[] sender;
+    }
+
+    public static class OutputNotes {
+        public byte[] owner;
+
+        public byte[] hash;
+
+        public byte[] meta_data;
+    }
 }
@@ -50,6 +50,10 @@ public class Confidential_validator extends WasmContract {
 
     public static final String FUNC_VALIDATEBURN = "ValidateBurn";
 
+    public static final String FUNC_VALIDATEPROOFS = "ValidateProofs";
+
+    public static final String FUNC_VALIDATECOMPACTPROOF = "ValidateCompactProof";
+
     public static final WasmEvent VALIDATORMIGRATEEVENT_EVENT = new WasmEvent("ValidatorMigrateEvent", Arrays.asList(new WasmEventParameter(WasmAddress.class, true) , new WasmEventParameter(WasmAddress.class, true)), Arrays.asList());
     ;
 
@@ -294,6 +298,16 @@ public class Confidential_validator extends WasmContract {
         return executeRemoteCall(function, byte[].class);
     }
 
+    public RemoteCall<byte[][]> ValidateProofs(byte[][] proofs) {
+        final WasmFunction function = new WasmFunction(FUNC_VALIDATEPROOFS, Arrays.asList(proofs, Void.class), byte[][].class);
+        return executeRemoteCall(function, byte[][].class);
+    }
+
+    public RemoteCall<byte[]> ValidateCompactProof(byte[] proof) {
+        final WasmFunction function = new WasmFunction(FUNC_VALIDATECOMPACTPROOF, Arrays.asList(proof, Void.class), byte[].class);
+        return executeRemoteCall(function, byte[].class);
+    }
+
     public static Confidential_validator load(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
         return new Confidential_validator(contractAddress, web3j, credentials, contractGasProvider, chainId);
     }
@@ -0,0 +1,96 @@
+package com.platon.privacy.contracts;
+
+import com.alaya.abi.wasm.WasmFunctionEncoder;
+import com.alaya.abi.wasm.datatypes.WasmFunction;
+import com.alaya.crypto.Credentials;
+import com.alaya.protocol.Web3j;
+import com.alaya.protocol.core.RemoteCall;
+import com.alaya.rlp.wasm.datatypes.Uint32;
+import com.alaya.rlp.wasm.datatypes.WasmAddress;
+import com.alaya.tx.TransactionManager;
+import com.alaya.tx.WasmContract;
+import com.alaya.tx.gas.GasProvider;
+import java.math.BigInteger;
+import java.util.Arrays;
+
+/**
+ * <p>Auto generated code.
+ * <p><strong>Do not modify!</strong>
+ * <p>Please use the <a href="https://github.com/PlatONnetwork/client-sdk-java/releases">platon-web3j command line tools</a>,
+ * or the com.alaya.codegen.WasmFunctionWrapperGenerator in the 
+ * <a href="https://github.com/PlatONnetwork/client-sdk-java/tree/master/codegen">codegen module</a> to update.
+ *
+ * <p>Generated with platon-web3j version none.
+ */
+public class Confidential_verify_test extends WasmContract {
+    private static String BINARY_0 = "";
+
+    public static String BINARY = BINARY_0;
+
+    public static final String FUNC_VERIFYONE = "VerifyOne";
+
+    public static final String FUNC_VERIFYEACH = "VerifyEach";
+
+    public static final String FUNC_VERIFYBATCH = "VerifyBatch";
+
+    protected Confidential_verify_test(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
+        super(BINARY, contractAddress, web3j, credentials, contractGasProvider, chainId);
+    }
+
+    protected Confidential_verify_test(String contractAddress, Web3j web3j, TransactionManager transactionManager, GasProvider contractGasProvider, Long chainId) {
+        super(BINARY, contractAddress, web3j, transactionManager, contractGasProvider, chainId);
+    }
+
+    public RemoteCall<VerifyResult> VerifyOne(byte[] tx) {
+        final WasmFunction function = new WasmFunction(FUNC_VERIFYONE, Arrays.asList(tx, Void.class), VerifyResult.class);
+        return executeRemoteCall(function, VerifyResult.class);
+    }
+
+    public static RemoteCall<Confidential_verify_test> deploy(Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
+        String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList());
+        return deployRemoteCall(Confidential_verify_test.class, web3j, credentials, contractGasProvider, encodedConstructor, chainId);
+    }
+
+    public static RemoteCall<Confidential_verify_test> deploy(Web3j web3j, TransactionManager transactionManager, GasProvider contractGasProvider, Long chainId) {
+        String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList());
+        return deployRemoteCall(Confidential_verify_test.class, web3j, transactionManager, contractGasProvider, encodedConstructor, chainId);
+    }
+
+    public static RemoteCall<Confidential_verify_test> deploy(Web3j web3j, Credentials credentials, GasProvider contractGasProvider, BigInteger initialVonValue, Long chainId) {
+        String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList());
+        return deployRemoteCall(Confidential_verify_test.class, web3j, credentials, contractGasProvider, encodedConstructor, initialVonValue, chainId);
+    }
+
+    public static RemoteCall<Confidential_verify_test> deploy(Web3j web3j, TransactionManager transactionManager, GasProvider contractGasProvider, BigInteger initialVonValue, Long chainId) {
+        String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList());
+        return deployRemoteCall(Confidential_verify_test.class, web3j, transactionManager, contractGasProvider, encodedConstructor, initialVonValue, chainId);
+    }
+
+    public RemoteCall<VerifyResult> VerifyEach(byte[][] txs) {
+        final WasmFunction function = new WasmFunction(FUNC_VERIFYEACH, Arrays.asList(txs, Void.class), VerifyResult.class);
+        return executeRemoteCall(function, VerifyResult.class);
+    }
+
+    public RemoteCall<VerifyResult> VerifyBatch(byte[][] txs) {
+        final WasmFunction function = new WasmFunction(FUNC_VERIFYBATCH, Arrays.asList(txs, Void.class), VerifyResult.class);
+        return executeRemoteCall(function, VerifyResult.class);
+    }
+
+    public static Confidential_verify_test load(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
+        return new Confidential_verify_test(contractAddress, web3j, credentials, contractGasProvider, chainId);
+    }
+
+    public static Confidential_verify_test load(String contractAddress, Web3j web3j, TransactionManager transactionManager, GasProvider contractGasProvider, Long chainId) {
+        return new Confidential_verify_test(contractAddress, web3j, transactionManager, contractGasProvider, chainId);
+    }
+
+    public static class VerifyResult {
+        public Boolean legal;
+
+        public Uint32 calls;
+
+        public byte[] tx_types;
+
+        public WasmAddress[] authorized;
+    }
+}
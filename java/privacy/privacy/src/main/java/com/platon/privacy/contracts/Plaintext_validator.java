@@ -49,6 +49,10 @@ public class Plaintext_validator extends WasmContract {
 
     public static final String FUNC_SUPPORTPROOF = "SupportProof";
 
+    public static final String FUNC_VALIDATEPROOFS = "ValidateProofs";
+
+    public static final String FUNC_VALIDATECOMPACTPROOF = "ValidateCompactProof";
+
     public static final WasmEvent TRANSFEREVENT_EVENT = new WasmEvent("TransferEvent", Arrays.asList(new WasmEventParameter(WasmAddress.class, true) , new WasmEventParameter(WasmAddress.class, true)), Arrays.asList(new WasmEventParameter(Uint128.class)));
     ;
 
@@ -295,6 +299,16 @@ public class Plaintext_validator extends WasmContract {
         return executeRemoteCall(function, Boolean.class);
     }
 
+    public RemoteCall<byte[][]> ValidateProofs(byte[][] proofs) {
+        final WasmFunction function = new WasmFunction(FUNC_VALIDATEPROOFS, Arrays.asList(proofs, Void.class), byte[][].class);
+        return executeRemoteCall(function, byte[][].class);
+    }
+
+    public RemoteCall<byte[]> ValidateCompactProof(byte[] proof) {
+        final WasmFunction function = new WasmFunction(FUNC_VALIDATECOMPACTPROOF, Arrays.asList(proof, Void.class), byte[].class);
+        return executeRemoteCall(function, byte[].class);
+    }
+
     public static Plaintext_validator load(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
         return new Plaintext_validator(contractAddress, web3j, credentials, contractGasProvider, chainId);
     }
@@ -0,0 +1,107 @@
+package com.platon.privacy.contracts;
+
+import com.alaya.abi.wasm.WasmFunctionEncoder;
+import com.alaya.abi.wasm.datatypes.WasmFunction;
+import com.alaya.crypto.Credentials;
+import com.alaya.protocol.Web3j;
+import com.alaya.protocol.core.RemoteCall;
+import com.alaya.protocol.core.methods.response.TransactionReceipt;
+import com.alaya.tx.TransactionManager;
+import com.alaya.tx.WasmContract;
+import com.alaya.tx.gas.GasProvider;
+import java.math.BigInteger;
+import java.util.Arrays;
+
+/**
+ * <p>Auto generated code.
+ * <p><strong>Do not modify!</strong>
+ * <p>Please use the <a href="https://github.com/PlatONnetwork/client-sdk-java/releases">platon-web3j command line tools</a>,
+ * or the com.alaya.codegen.WasmFunctionWrapperGenerator in the 
+ * <a href="https://github.com/PlatONnetwork/client-sdk-java/tree/master/codegen">codegen module</a> to update.
+ *
+ * <p>Generated with platon-web3j version none.
+ */
+public class State_cache_test extends WasmContract {
+    private static String BINARY_0 = "";
+
+    public static String BINARY = BINARY_0;
+
+    public static final String FUNC_CHECK = "Check";
+
+    public static final String FUNC_WRITE = "Write";
+
+    public static final String FUNC_CHECKGROWTH = "CheckGrowth";
+
+    public static final String FUNC_READ = "Read";
+
+    protected State_cache_test(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
+        super(BINARY, contractAddress, web3j, credentials, contractGasProvider, chainId);
+    }
+
+    protected State_cache_test(String contractAddress, Web3j web3j, TransactionManager transactionManager, GasProvider contractGasProvider, Long chainId) {
+        super(BINARY, contractAddress, web3j, transactionManager, contractGasProvider, chainId);
+    }
+
+    public RemoteCall<TransactionReceipt> Check(byte[] present, byte[] missing) {
+        final WasmFunction function = new WasmFunction(FUNC_CHECK, Arrays.asList(present,missing), Void.class);
+        return executeRemoteCallTransaction(function);
+    }
+
+    public RemoteCall<TransactionReceipt> Check(byte[] present, byte[] missing, BigInteger vonValue) {
+        final WasmFunction function = new WasmFunction(FUNC_CHECK, Arrays.asList(present,missing), Void.class);
+        return executeRemoteCallTransaction(function, vonValue);
+    }
+
+    public static RemoteCall<State_cache_test> deploy(Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
+        String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList());
+        return deployRemoteCall(State_cache_test.class, web3j, credentials, contractGasProvider, encodedConstructor, chainId);
+    }
+
+    public static RemoteCall<State_cache_test> deploy(Web3j web3j, TransactionManager transactionManager, GasProvider contractGasProvider, Long chainId) {
+        String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList());
+        return deployRemoteCall(State_cache_test.class, web3j, transactionManager, contractGasProvider, encodedConstructor, chainId);
+    }
+
+    public static RemoteCall<State_cache_test> deploy(Web3j web3j, Credentials credentials, GasProvider contractGasProvider, BigInteger initialVonValue, Long chainId) {
+        String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList());
+        return deployRemoteCall(State_cache_test.class, web3j, credentials, contractGasProvider, encodedConstructor, initialVonValue, chainId);
+    }
+
+    public static RemoteCall<State_cache_test> deploy(Web3j web3j, TransactionManager transactionManager, GasProvider contractGasProvider, BigInteger initialVonValue, Long chainId) {
+        String encodedConstructor = WasmFunctionEncoder.encodeConstructor(BINARY, Arrays.asList());
+        return deployRemoteCall(State_cache_test.class, web3j, transactionManager, contractGasProvider, encodedConstructor, initialVonValue, chainId);
+    }
+
+    public RemoteCall<TransactionReceipt> Write(byte[][] keys, byte[] value) {
+        final WasmFunction function = new WasmFunction(FUNC_WRITE, Arrays.asList(keys,value), Void.class);
+        return executeRemoteCallTransaction(function);
+    }
+
+    public RemoteCall<TransactionReceipt> Write(byte[][] keys, byte[] value, BigInteger vonValue) {
+        final WasmFunction function = new WasmFunction(FUNC_WRITE, Arrays.asList(keys,value), Void.class);
+        return executeRemoteCallTransaction(function, vonValue);
+    }
+
+    public RemoteCall<TransactionReceipt> CheckGrowth(byte[] seed) {
+        final WasmFunction function = new WasmFunction(FUNC_CHECKGROWTH, Arrays.asList(seed, Void.class), Void.class);
+        return executeRemoteCallTransaction(function);
+    }
+
+    public RemoteCall<TransactionReceipt> CheckGrowth(byte[] seed, BigInteger vonValue) {
+        final WasmFunction function = new WasmFunction(FUNC_CHECKGROWTH, Arrays.asList(seed, Void.class), Void.class);
+        return executeRemoteCallTransaction(function, vonValue);
+    }
+
+    public RemoteCall<byte[]> Read(byte[] key) {
+        final WasmFunction function = new WasmFunction(FUNC_READ, Arrays.asList(key, Void.class), byte[].class);
+        return executeRemoteCall(function, byte[].class);
+    }
+
+    public static State_cache_test load(String contractAddress, Web3j web3j, Credentials credentials, GasProvider contractGasProvider, Long chainId) {
+        return new State_cache_test(contractAddress, web3j, credentials, contractGasProvider, chainId);
+    }
+
+    public static State_cache_test load(String contractAddress, Web3j web3j, TransactionManager transactionManager, GasProvider contractGasProvider, Long chainId) {
+        return new State_cache_test(contractAddress, web3j, transactionManager, contractGasProvider, chainId);
+    }
+}
@@ -9,6 +9,7 @@ import com.alaya.rlp.wasm.datatypes.Int128;
 import com.alaya.rlp.wasm.datatypes.Uint32;
 import com.alaya.rlp.wasm.datatypes.WasmAddress;
 import com.google.common.primitives.Bytes;
+import com.google.common.primitives.Ints;
 
 
 import java.math.BigInteger;
@@ -22,6 +23,11 @@ public class Plaintext {
     public static long major = 1 << 16;
     public static long minor = 1 << 8;
     public static long currentVersion = category + major + minor;
+    // From this version on the proof signature authorizes the inputs owned by the proof signer
+    public static long signerInputsVersion = category + major + 2 * minor;
+    // Proofs of this version use the flat envelope | version(4) | fields | signature(65) |,
+    // the signer inputs rule applies to them
+    public static long flatVersion = category + 2 * major + minor;
     public static long transferProof = 1;
     public static long mintProof = 2;
     public static long burnProof = 3;
@@ -60,6 +66,24 @@ public class Plaintext {
         return pns;
     }
 
+    /**
+     * Inputs owned by the signer of a proof of signerInputsVersion or later, they carry no
+     * signature of their own.
+     */
+    public static Plaintext.PlaintextInputNote[] createSignerInputs(
+            List<Plaintext.PlaintextNote> notes) {
+        Plaintext.PlaintextInputNote[] pns = new Plaintext.PlaintextInputNote[notes.size()];
+        for (int i = 0; i < notes.size(); i++) {
+            pns[i] =
+                    new Plaintext.PlaintextInputNote(
+                            new WasmAddress(notes.get(i).owner.getAddress()),
+                            notes.get(i).value,
+                            notes.get(i).random,
+                            new byte[0]);
+        }
+        return pns;
+    }
+
     public static Plaintext.PlaintextProof createProof(
             Plaintext.PlaintextUTXO utxo, Credentials admin) {
         return createProof(utxo, admin, currentVersion);
@@ -79,6 +103,17 @@ public class Plaintext {
         return proof;
     }
 
+    /**
+     * Flat proof of the data of a proof type, the data is the RLP field list of the proof, it
+     * is passed to the contract as is instead of RLP encoding a PlaintextProof.
+     */
+    public static byte[] createFlatProof(Object data, long type, Credentials admin) {
+        byte[] signedData =
+                Bytes.concat(Ints.toByteArray((int) (flatVersion + type)), RLPCodec.encode(data));
+        Sign.SignatureData signatureData = Sign.signMessage(signedData, admin.getEcKeyPair());
+        return Bytes.concat(signedData, signToBytes(signatureData));
+    }
+
     public static byte[] signToBytes(Sign.SignatureData sig) {
         byte v = sig.getV()[0];
         v -= 27;
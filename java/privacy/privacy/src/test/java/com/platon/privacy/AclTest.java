@@ -25,6 +25,7 @@ import org.junit.jupiter.api.Order;
 import org.junit.jupiter.api.Test;
 
 import java.math.BigInteger;
+import java.util.Arrays;
 
 public class AclTest {
     public static String tokenName = "ABC";
@@ -338,4 +339,194 @@ public class AclTest {
                 registry.baseClass.total_supply.value.longValue() - 201,
                 burnRegistry.baseClass.total_supply.getValue().longValue());
     }
+
+    @Test
+    @Order(8)
+    public void testSharedValidator() throws Exception {
+        String validatorAddr = Deploy.deployPlaintextValidator().getContractAddress();
+        String signerInputsAddr = Deploy.deployPlaintextValidator().getContractAddress();
+        String storageAddr = Deploy.deployStorage().getContractAddress();
+        Token_manager tokenManager =
+                Token_manager.deploy(
+                                Web.chainManager.getWeb3j(),
+                                Web.txManager,
+                                Web.chainManager.getGasProvider(),
+                                Web.chainManager.getChainId(),
+                                new WasmAddress(BigInteger.ZERO))
+                        .send();
+        Acl acl = Deploy.deployAcl(false, "", tokenManager);
+        acl.CreateValidator(Uint32.of(Plaintext.currentVersion), new WasmAddress(validatorAddr), "")
+                .send();
+        acl.CreateValidator(
+                        Uint32.of(Plaintext.signerInputsVersion),
+                        new WasmAddress(signerInputsAddr),
+                        "")
+                .send();
+        acl.CreateStorage(Uint32.of(Plaintext.currentVersion), new WasmAddress(storageAddr), "")
+                .send();
+
+        Acl.RegistryOptions shared = new Acl.RegistryOptions();
+        shared.storage_options = Uint32.of(0);
+        shared.storage_shards = Uint8.of(0);
+        shared.shared_validator = true;
+        Acl user1Acl =
+                Acl.load(
+                        acl.getContractAddress(),
+                        Web.chainManager.getWeb3j(),
+                        Web.user1,
+                        Web.chainManager.getGasProvider(),
+                        Web.chainManager.getChainId());
+        Acl user2Acl =
+                Acl.load(
+                        acl.getContractAddress(),
+                        Web.chainManager.getWeb3j(),
+                        Web.user2,
+                        Web.chainManager.getGasProvider(),
+                        Web.chainManager.getChainId());
+        for (Acl one : new Acl[] {acl, user1Acl}) {
+            Assertions.assertTrue(
+                    one.CreateRegistryWithOptions(
+                                    Uint32.of(Plaintext.currentVersion),
+                                    Uint32.of(Plaintext.currentVersion),
+                                    Uint128.of(0),
+                                    new WasmAddress(BigInteger.ZERO),
+                                    false,
+                                    shared)
+                            .send()
+                            .isStatusOK());
+        }
+        user2Acl.CreateRegistry(
+                        Uint32.of(Plaintext.currentVersion),
+                        Uint32.of(Plaintext.currentVersion),
+                        Uint128.of(0),
+                        new WasmAddress(BigInteger.ZERO),
+                        false)
+                .send();
+
+        WasmAddress admin = new WasmAddress(Web.admin.getAddress());
+        WasmAddress user1 = new WasmAddress(Web.user1.getAddress());
+        WasmAddress user2 = new WasmAddress(Web.user2.getAddress());
+        WasmAddress sharedValidator = acl.GetRegistry(admin).send().validator_addr;
+        Assertions.assertEquals(sharedValidator, acl.GetRegistry(user1).send().validator_addr);
+        Assertions.assertNotEquals(sharedValidator, acl.GetRegistry(user2).send().validator_addr);
+
+        // a shared token moves to the validator shared by the new version
+        acl.UpdateValidator(Uint32.of(Plaintext.signerInputsVersion)).send();
+        Acl.Registry registry = acl.GetRegistry(admin).send();
+        Assertions.assertEquals(
+                Plaintext.signerInputsVersion,
+                registry.baseClass.validator_version.value.longValue());
+        Assertions.assertEquals(
+                Plaintext.currentVersion, registry.baseClass.storage_version.value.longValue());
+        Assertions.assertNotEquals(sharedValidator, registry.validator_addr);
+        Assertions.assertEquals(sharedValidator, acl.GetRegistry(user1).send().validator_addr);
+
+        // a token with a validator of its own records its validator version too
+        user2Acl.UpdateValidator(Uint32.of(Plaintext.signerInputsVersion)).send();
+        registry = acl.GetRegistry(user2).send();
+        Assertions.assertEquals(
+                Plaintext.signerInputsVersion,
+                registry.baseClass.validator_version.value.longValue());
+        Assertions.assertEquals(
+                Plaintext.currentVersion, registry.baseClass.storage_version.value.longValue());
+
+        Plaintext.PlaintextOutputNote[] outputs =
+                Common.createOutputs(new Common.Note[] {new Common.Note(Web.admin, 10)});
+        Plaintext.PlaintextUTXO utxo =
+                new Plaintext.PlaintextUTXO(
+                        new Plaintext.PlaintextInputNote[0],
+                        outputs,
+                        admin,
+                        Int128.of(-10),
+                        null);
+        Plaintext.PlaintextProof proof =
+                Plaintext.createProof(utxo, Web.admin, Plaintext.signerInputsVersion);
+        byte[] stream = acl.ValidateProof(RLPCodec.encode(proof)).send();
+        Validator.TransferResult result =
+                RLPCodec.decode(
+                        stream, Validator.TransferResult.class, Web.chainManager.getChainId());
+        Assertions.assertEquals(1, result.outputs.length);
+        Assertions.assertEquals(-10, result.publicValue.value.longValue());
+    }
+
+    /** With four storage shards every minted note is kept by exactly one shard storage. */
+    @Test
+    @Order(9)
+    public void testStorageShards() throws Exception {
+        String validatorAddr = Deploy.deployPlaintextValidator().getContractAddress();
+        String storageAddr = Deploy.deployStorage().getContractAddress();
+        Token_manager tokenManager =
+                Token_manager.deploy(
+                                Web.chainManager.getWeb3j(),
+                                Web.txManager,
+                                Web.chainManager.getGasProvider(),
+                                Web.chainManager.getChainId(),
+                                new WasmAddress(BigInteger.ZERO))
+                        .send();
+        Acl acl = Deploy.deployAcl(false, "", tokenManager);
+        acl.CreateValidator(Uint32.of(Plaintext.currentVersion), new WasmAddress(validatorAddr), "")
+                .send();
+        acl.CreateStorage(Uint32.of(Plaintext.currentVersion), new WasmAddress(storageAddr), "")
+                .send();
+        Acl.RegistryOptions sharded = new Acl.RegistryOptions();
+        sharded.storage_options = Uint32.of(0);
+        sharded.storage_shards = Uint8.of(4);
+        sharded.shared_validator = false;
+        Assertions.assertTrue(
+                acl.CreateRegistryWithOptions(
+                                Uint32.of(Plaintext.currentVersion),
+                                Uint32.of(Plaintext.currentVersion),
+                                Uint128.of(0),
+                                new WasmAddress(BigInteger.ZERO),
+                                true,
+                                sharded)
+                        .send()
+                        .isStatusOK());
+
+        WasmAddress admin = new WasmAddress(Web.admin.getAddress());
+        WasmAddress[] shards = acl.GetStorageShards(admin).send();
+        Assertions.assertEquals(4, shards.length);
+        Assertions.assertEquals(acl.GetRegistry(admin).send().storage_addr, shards[0]);
+
+        Common.Note[] notes = new Common.Note[8];
+        for (int i = 0; i < notes.length; i++) {
+            notes[i] = new Common.Note(Web.admin, 10 + i);
+        }
+        Plaintext.PlaintextOutputNote[] outputs = Common.createOutputs(notes);
+        Plaintext.PlaintextMint mint =
+                new Plaintext.PlaintextMint(
+                        acl.GetRegistry(admin).send().baseClass.last_mint_hash, outputs);
+        Assertions.assertTrue(
+                acl.Mint(RLPCodec.encode(Plaintext.createMint(mint, Web.admin)))
+                        .send()
+                        .isStatusOK());
+
+        byte[][] hashes = new byte[outputs.length][];
+        for (int i = 0; i < outputs.length; i++) {
+            hashes[i] = outputs[i].hash();
+        }
+        int[] copies = new int[hashes.length];
+        for (WasmAddress shard : shards) {
+            Storage storage =
+                    Storage.load(
+                            shard.getAddress(),
+                            Web.chainManager.getWeb3j(),
+                            Web.txManager,
+                            Web.chainManager.getGasProvider(),
+                            Web.chainManager.getChainId());
+            Storage.NoteStatus[] statuses = storage.GetNotes(hashes).send();
+            for (int i = 0; i < hashes.length; i++) {
+                if (Arrays.equals(hashes[i], statuses[i].hash)) {
+                    copies[i]++;
+                }
+            }
+        }
+        for (int i = 0; i < hashes.length; i++) {
+            Assertions.assertEquals(1, copies[i]);
+        }
+        Acl.NoteStatus[] statuses = acl.GetNotes(hashes).send();
+        for (int i = 0; i < hashes.length; i++) {
+            Assertions.assertArrayEquals(hashes[i], statuses[i].hash);
+        }
+    }
 }
@@ -127,6 +127,24 @@ public class ConfidentialDeploy {
         return token;
     }
 
+    public static Confidential_options_token deployOptionsToken(
+            Token token, Confidential_options_token.RegistryOptions options) throws Exception {
+        return Confidential_options_token.deploy(
+                        Web.chainManager.getWeb3j(),
+                        Web.txManager,
+                        Web.chainManager.getGasProvider(),
+                        Web.chainManager.getChainId(),
+                        tokenName,
+                        tokenSymbol,
+                        RegistryDeploy.registryAddress,
+                        Uint32.of(Confidential.currentVersion),
+                        Uint32.of(Confidential.currentVersion),
+                        scalingFactor,
+                        new WasmAddress(token.arc20.getContractAddress()),
+                        options)
+                .send();
+    }
+
     public static void minorUpdate(Token token) throws Exception {
         Confidential_storage minorUpdateStorage =
                 Confidential_storage.deploy(
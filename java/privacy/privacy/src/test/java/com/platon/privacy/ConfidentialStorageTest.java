@@ -0,0 +1,194 @@
+package com.platon.privacy;
+
+import com.alaya.crypto.Hash;
+import com.alaya.protocol.core.methods.response.TransactionReceipt;
+import com.alaya.protocol.exceptions.TransactionException;
+import com.alaya.rlp.wasm.RLPCodec;
+import com.alaya.rlp.wasm.datatypes.Int128;
+import com.alaya.rlp.wasm.datatypes.Uint32;
+import com.alaya.rlp.wasm.datatypes.WasmAddress;
+import com.platon.privacy.contracts.Confidential_storage;
+import org.junit.jupiter.api.*;
+
+import java.math.BigInteger;
+
+/**
+ * Compares the default note layout of the confidential storage with the kSpentMarker layout, a
+ * live record per note plus a compact set of the spent notes. The number of notes, a multiple of
+ * 8, is taken from the benchmark.notes property. Run with -Dbenchmark.notes=1048576 for the 1M
+ * note comparison.
+ */
+@TestMethodOrder(MethodOrderer.OrderAnnotation.class)
+public class ConfidentialStorageTest {
+    private static final int digestOwnerOption = 1 << 0; // kDigestOwner
+    private static final int spentMarkerOption = 1 << 4; // kSpentMarker
+    private static final int notes = Integer.getInteger("benchmark.notes", 64);
+    private static final int notesPerUpdate = 8;
+    private static final WasmAddress adminAddress = new WasmAddress(Web.admin.getAddress());
+    private static Confidential_storage plain;
+    private static Confidential_storage marker;
+
+    @BeforeAll
+    public static void deployContract() throws Exception {
+        Assertions.assertEquals(0, notes % notesPerUpdate);
+        plain = deployStorage(0);
+        marker = deployStorage(spentMarkerOption);
+    }
+
+    private static Confidential_storage deployStorage(int options) throws Exception {
+        Confidential_storage storage =
+                Confidential_storage.deploy(
+                                Web.chainManager.getWeb3j(),
+                                Web.txManager,
+                                Web.chainManager.getGasProvider(),
+                                Web.chainManager.getChainId())
+                        .send();
+        Assertions.assertTrue(
+                storage.CreateRegistryWithOptions(true, Uint32.of(options)).send().isStatusOK());
+        return storage;
+    }
+
+    private static byte[] noteHash(int id) {
+        return Hash.sha3(BigInteger.valueOf(id).toByteArray());
+    }
+
+    private static byte[] update(int spent, int created, int count) {
+        Validator.InputNotes[] inputs = new Validator.InputNotes[spent < 0 ? 0 : count];
+        for (int i = 0; i < inputs.length; i++) {
+            byte[] id = BigInteger.valueOf(spent + i).toByteArray();
+            inputs[i] = new Validator.InputNotes(id, noteHash(spent + i));
+        }
+        Validator.OutputNotes[] outputs = new Validator.OutputNotes[created < 0 ? 0 : count];
+        for (int i = 0; i < outputs.length; i++) {
+            byte[] id = BigInteger.valueOf(created + i).toByteArray();
+            outputs[i] = new Validator.OutputNotes(id, noteHash(created + i), id);
+        }
+        return RLPCodec.encode(
+                new Validator.TransferResult(
+                        inputs,
+                        outputs,
+                        new WasmAddress(BigInteger.ZERO),
+                        Int128.of(0),
+                        adminAddress.getValue()));
+    }
+
+    private static BigInteger run(Confidential_storage storage, byte[] update) throws Exception {
+        TransactionReceipt receipt = storage.UpdateNotes(update).send();
+        Assertions.assertTrue(receipt.isStatusOK());
+        return receipt.getGasUsed();
+    }
+
+    private static void print(String phase, BigInteger plainGas, BigInteger markerGas) {
+        BigInteger count = BigInteger.valueOf(notes);
+        System.out.println(
+                phase
+                        + " notes:" + notes
+                        + " gas per note default:" + plainGas.divide(count)
+                        + " spent marker:" + markerGas.divide(count));
+    }
+
+    @Test
+    @Order(1)
+    public void testCreate() throws Exception {
+        BigInteger plainGas = BigInteger.ZERO;
+        BigInteger markerGas = BigInteger.ZERO;
+        for (int i = 0; i < notes; i += notesPerUpdate) {
+            byte[] update = update(-1, i, notesPerUpdate);
+            plainGas = plainGas.add(run(plain, update));
+            markerGas = markerGas.add(run(marker, update));
+        }
+        print("create", plainGas, markerGas);
+
+        BigInteger plainBytes = plain.GetStats().send().state_bytes.value;
+        BigInteger markerBytes = marker.GetStats().send().state_bytes.value;
+        Assertions.assertEquals(plainBytes, markerBytes);
+        System.out.println(
+                "state bytes per live note default:"
+                        + plainBytes.divide(BigInteger.valueOf(notes))
+                        + " spent marker:" + markerBytes.divide(BigInteger.valueOf(notes)));
+    }
+
+    @Test
+    @Order(2)
+    public void testSpend() throws Exception {
+        BigInteger plainGas = BigInteger.ZERO;
+        BigInteger markerGas = BigInteger.ZERO;
+        for (int i = 0; i < notes; i += notesPerUpdate) {
+            byte[] update = update(i, -1, notesPerUpdate);
+            plainGas = plainGas.add(run(plain, update));
+            markerGas = markerGas.add(run(marker, update));
+        }
+        print("spend", plainGas, markerGas);
+
+        Confidential_storage.StorageStats plainStats = plain.GetStats().send();
+        Confidential_storage.StorageStats markerStats = marker.GetStats().send();
+        Assertions.assertEquals(0, plainStats.live_notes.value.intValue());
+        Assertions.assertEquals(0, markerStats.live_notes.value.intValue());
+        // the values of the spent set, one byte under a 16 byte key per note
+        Assertions.assertEquals(notes, markerStats.state_bytes.value.intValue());
+        System.out.println(
+                "state bytes after spending default:" + plainStats.state_bytes.value
+                        + " spent marker:" + markerStats.state_bytes.value);
+    }
+
+    @Test
+    @Order(3)
+    public void testRecreateSpent() throws Exception {
+        byte[] update = update(-1, 0, 1);
+        Assertions.assertTrue(plain.UpdateNotes(update).send().isStatusOK());
+        Assertions.assertThrows(
+                TransactionException.class,
+                () -> {
+                    marker.UpdateNotes(update).send();
+                });
+    }
+
+    /** A kDigestOwner storage keeps and returns the sha3 of the owner instead of the owner. */
+    @Test
+    @Order(4)
+    public void testDigestOwner() throws Exception {
+        Confidential_storage digest = deployStorage(digestOwnerOption);
+        byte[] owner = new byte[68];
+        for (int i = 0; i < owner.length; i++) {
+            owner[i] = (byte) i;
+        }
+        byte[] hash = noteHash(notes);
+        byte[] create =
+                RLPCodec.encode(
+                        new Validator.TransferResult(
+                                new Validator.InputNotes[0],
+                                new Validator.OutputNotes[] {
+                                    new Validator.OutputNotes(owner, hash, owner)
+                                },
+                                new WasmAddress(BigInteger.ZERO),
+                                Int128.of(0),
+                                adminAddress.getValue()));
+        Assertions.assertTrue(digest.UpdateNotes(create).send().isStatusOK());
+        Assertions.assertTrue(plain.UpdateNotes(create).send().isStatusOK());
+
+        Assertions.assertArrayEquals(Hash.sha3(owner), digest.GetNote(hash).send().owner);
+        Assertions.assertArrayEquals(owner, plain.GetNote(hash).send().owner);
+    }
+
+    /** The counters of GetStats follow creates and spends, erased records free their bytes. */
+    @Test
+    @Order(5)
+    public void testStats() throws Exception {
+        Confidential_storage stats = deployStorage(0);
+        int first = notes + 1;
+        run(stats, update(-1, first, 3));
+        run(stats, update(first, -1, 1));
+        Confidential_storage.StorageStats after = stats.GetStats().send();
+        Assertions.assertEquals(2, after.live_notes.value.intValue());
+        Assertions.assertEquals(3, after.created_notes.value.intValue());
+        Assertions.assertEquals(1, after.destroyed_notes.value.intValue());
+        Assertions.assertEquals(0, after.approvals.value.intValue());
+        Assertions.assertTrue(after.state_bytes.value.signum() > 0);
+
+        run(stats, update(first + 1, -1, 2));
+        Confidential_storage.StorageStats empty = stats.GetStats().send();
+        Assertions.assertEquals(0, empty.live_notes.value.intValue());
+        Assertions.assertEquals(3, empty.destroyed_notes.value.intValue());
+        Assertions.assertEquals(0, empty.state_bytes.value.intValue());
+    }
+}
@@ -8,11 +8,14 @@ import com.alaya.protocol.core.methods.response.TransactionReceipt;
 import com.alaya.rlp.wasm.RLPCodec;
 import com.alaya.rlp.wasm.datatypes.Uint128;
 import com.alaya.rlp.wasm.datatypes.Uint32;
+import com.alaya.rlp.wasm.datatypes.Uint8;
 import com.alaya.rlp.wasm.datatypes.WasmAddress;
 import com.alaya.tx.WasmContract;
 import com.google.common.primitives.Bytes;
 import com.platon.privacy.confidential.Confidential;
 import com.platon.privacy.confidential.ConfidentialTxJNA;
+import com.platon.privacy.contracts.Acl;
+import com.platon.privacy.contracts.Confidential_options_token;
 import com.platon.privacy.contracts.Confidential_token;
 import com.platon.privacy.contracts.Confidential_validator;
 import org.apache.commons.codec.binary.Hex;
@@ -55,10 +58,7 @@ public class  ConfidentialTokenTest {
 
                                 byte[] ownerValue = (byte[]) values.getNonIndexedValues().get(0);
                                 Confidential.EncryptedOwner oneOwner =
-                                        RLPCodec.decode(
-                                                ownerValue,
-                                                Confidential.EncryptedOwner.class,
-                                                Web.chainManager.getChainId());
+                                        Confidential.EncryptedOwner.decode(ownerValue);
                                 boolean boolOwner =
                                         false;
                                 try {
@@ -341,6 +341,7 @@ public class  ConfidentialTokenTest {
 
         TransactionReceipt receipt = token.confidentialToken.Mint(RLPCodec.encode(proof)).send();
         Assertions.assertTrue(receipt.isStatusOK());
+        System.out.println("mint gas used:" + receipt.getGasUsed());
 
         fetchOutputFromReceipt(receipt);
 
@@ -401,6 +402,7 @@ public class  ConfidentialTokenTest {
 
         TransactionReceipt receipt = token.confidentialToken.Burn(RLPCodec.encode(proof)).send();
         Assertions.assertTrue(receipt.isStatusOK());
+        System.out.println("burn gas used:" + receipt.getGasUsed());
         Assertions.assertEquals(
                 totalSupply - 1, token.confidentialToken.TotalSupply().send().getValue().longValue());
 
@@ -446,6 +448,7 @@ public class  ConfidentialTokenTest {
 
         TransactionReceipt receipt = token.confidentialToken.Transfer(RLPCodec.encode(proof)).send();
         Assertions.assertTrue(receipt.isStatusOK());
+        System.out.println("transfer gas used:" + receipt.getGasUsed());
 
         fetchOutputFromReceipt(receipt);
 
@@ -504,6 +507,7 @@ public class  ConfidentialTokenTest {
 
         TransactionReceipt receipt = token.confidentialToken.Transfer(RLPCodec.encode(proof)).send();
         Assertions.assertTrue(receipt.isStatusOK());
+        System.out.println("deposit gas used:" + receipt.getGasUsed());
 
         fetchOutputFromReceipt(receipt);
 
@@ -562,6 +566,7 @@ public class  ConfidentialTokenTest {
 
         TransactionReceipt receipt = token.confidentialToken.Transfer(RLPCodec.encode(proof)).send();
         Assertions.assertTrue(receipt.isStatusOK());
+        System.out.println("withdraw gas used:" + receipt.getGasUsed());
 
         fetchOutputFromReceipt(receipt);
 
@@ -606,4 +611,141 @@ public class  ConfidentialTokenTest {
 
         getMetaDataEvent(receipt);
     }
+
+    @Test
+    @Order(8)
+    public void testOptionsToken() throws Exception {
+        Confidential_options_token.RegistryOptions options =
+                new Confidential_options_token.RegistryOptions();
+        options.storage_options = Uint32.of(1); // kDigestOwner
+        options.storage_shards = Uint8.of(0);
+        options.shared_validator = true;
+        Confidential_options_token first = ConfidentialDeploy.deployOptionsToken(token, options);
+        Confidential_options_token second = ConfidentialDeploy.deployOptionsToken(token, options);
+        Assertions.assertEquals(Deploy.tokenName, first.Name().send());
+
+        Acl.Registry firstRegistry =
+                token.acl.GetRegistry(new WasmAddress(first.getContractAddress())).send();
+        Acl.Registry secondRegistry =
+                token.acl.GetRegistry(new WasmAddress(second.getContractAddress())).send();
+        Acl.Registry defaultRegistry =
+                token.acl
+                        .GetRegistry(new WasmAddress(token.confidentialToken.getContractAddress()))
+                        .send();
+        Assertions.assertEquals(firstRegistry.validator_addr, secondRegistry.validator_addr);
+        Assertions.assertNotEquals(defaultRegistry.validator_addr, firstRegistry.validator_addr);
+        Assertions.assertNotEquals(firstRegistry.storage_addr, secondRegistry.storage_addr);
+    }
+
+    private static TransactionReceipt transferAt(
+            long version, Confidential.ConfidentialInput in) throws Exception {
+        Confidential.Transfer transfer = new Confidential.Transfer();
+        transfer.authorized_address = authorizedAddress;
+        transfer.input.add(in);
+        transfer.output.add(new Confidential.ConfidentialOutput(confidential, in.quatity));
+        byte[] buf = RLPCodec.encode(transfer);
+
+        Confidential.TransferExtra extra = new Confidential.TransferExtra();
+        extra.publicOwner = new WasmAddress(Web.admin.getAddress());
+        Confidential.ConfidentialData data = new Confidential.ConfidentialData();
+        data.version = Uint32.of(version + transfer.tx_type);
+        data.confidentialTx = ConfidentialTxJNA.create_confidential_tx_by_rlp(buf, buf.length);
+        data.extraData = RLPCodec.encode(extra);
+        byte[] rawData = RLPCodec.encode(data);
+
+        Confidential.ConfidentialProof proof = new Confidential.ConfidentialProof();
+        proof.data = rawData;
+        proof.signature = signRawData(rawData);
+        TransactionReceipt receipt = token.confidentialToken.Transfer(RLPCodec.encode(proof)).send();
+        Assertions.assertTrue(receipt.isStatusOK());
+        return receipt;
+    }
+
+    private static List<byte[]> destroyedOwners(TransactionReceipt receipt) {
+        String destoryNoteEvent =
+                ConfidentialDeploy.encodeEventName(Confidential_token.DESTROYNOTEEVENT_EVENT.getName());
+        List<byte[]> owners = new ArrayList<>();
+        for (Log log : receipt.getLogs()) {
+            if (log.getTopics().get(0).equals(destoryNoteEvent)) {
+                WasmEventValues values =
+                        WasmContract.staticExtractEventParameters(
+                                Confidential_token.DESTROYNOTEEVENT_EVENT,
+                                log,
+                                Web.chainManager.getChainId());
+                owners.add((byte[]) values.getNonIndexedValues().get(0));
+            }
+        }
+        return owners;
+    }
+
+    /**
+     * Notes keep the RLP owner whatever the version of the proofs that create and spend them, a
+     * note created by an older proof is spent by a minor version 2 proof and the other way round.
+     */
+    @Test
+    @Order(9)
+    public void testFixedPointsTransfer() throws Exception {
+        final int ownerSize = 68;
+
+        Confidential.ConfidentialInput legacyNote = input.remove(0);
+        TransactionReceipt receipt = transferAt(Confidential.fixedPointsVersion, legacyNote);
+        fetchOutputFromReceipt(receipt);
+        Map<String, Confidential.OutputInfo> txOutputInfo = getCreateNoteEvent(receipt);
+        Assertions.assertEquals(1, txOutputInfo.size());
+        String hash = txOutputInfo.keySet().iterator().next();
+        String createdOwner = txOutputInfo.get(hash).owner;
+        Assertions.assertEquals(ownerSize * 2, createdOwner.length());
+        Confidential_token.NoteStatus[] stored =
+                token.confidentialToken
+                        .GetNotes(new byte[][] {Hex.decodeHex(hash.substring(2))})
+                        .send();
+        Assertions.assertEquals(createdOwner, Hex.encodeHexString(stored[0].owner));
+        List<byte[]> owners = destroyedOwners(receipt);
+        Assertions.assertEquals(1, owners.size());
+        Assertions.assertEquals(ownerSize, owners.get(0).length);
+        getDestoryNoteEvent(receipt);
+
+        Confidential.ConfidentialInput fixedNote = input.remove(input.size() - 1);
+        receipt = transferAt(Confidential.currentVersion, fixedNote);
+        fetchOutputFromReceipt(receipt);
+        owners = destroyedOwners(receipt);
+        Assertions.assertEquals(1, owners.size());
+        Assertions.assertEquals(createdOwner, Hex.encodeHexString(owners.get(0)));
+        getDestoryNoteEvent(receipt);
+
+        Assertions.assertEquals(input.size(), outputInfo.size());
+    }
+
+    /**
+     * Proofs of major version 0 are served like 1.1 whatever their minor version, and approve
+     * proofs of 1.1 stay reported as supported.
+     */
+    @Test
+    @Order(10)
+    public void testSupportProof() throws Exception {
+        long legacyVersion = Confidential.name + Confidential.minor;
+        long[] supported = {
+            Confidential.currentVersion + Confidential.ConfidentialTXType.TRANSFER,
+            Confidential.currentVersion + Confidential.ConfidentialTXType.APPROVE,
+            legacyVersion + Confidential.ConfidentialTXType.TRANSFER,
+            Confidential.name + (5 << 8) + Confidential.ConfidentialTXType.MINT,
+            Confidential.flatVersion + Confidential.ConfidentialTXType.BURN
+        };
+        for (long version : supported) {
+            Assertions.assertTrue(token.confidentialToken.SupportProof(Uint32.of(version)).send());
+        }
+        long[] unsupported = {
+            Confidential.currentVersion - Confidential.minor
+                    + Confidential.ConfidentialTXType.TRANSFER,
+            Confidential.flatVersion + Confidential.ConfidentialTXType.APPROVE
+        };
+        for (long version : unsupported) {
+            Assertions.assertFalse(token.confidentialToken.SupportProof(Uint32.of(version)).send());
+        }
+
+        TransactionReceipt receipt = transferAt(legacyVersion, input.remove(0));
+        fetchOutputFromReceipt(receipt);
+        getDestoryNoteEvent(receipt);
+        Assertions.assertEquals(input.size(), outputInfo.size());
+    }
 }
@@ -0,0 +1,95 @@
+package com.platon.privacy;
+
+import com.alaya.rlp.wasm.RLPCodec;
+import com.alaya.rlp.wasm.datatypes.Uint64;
+import com.alaya.rlp.wasm.datatypes.WasmAddress;
+import com.platon.privacy.confidential.Confidential;
+import com.platon.privacy.contracts.Confidential_verify_test;
+import org.junit.jupiter.api.*;
+
+/**
+ * Batched confidential verification against the node-free stub of the host
+ * functions, see contracts/src/test/confidential_verify_test.cpp. A stub
+ * transaction is the RLP of the ConfidentialUTXO it verifies to.
+ */
+@TestMethodOrder(MethodOrderer.OrderAnnotation.class)
+public class ConfidentialVerifyTest {
+    private static Confidential_verify_test verifier;
+
+    @BeforeAll
+    public static void deployContract() throws Exception {
+        verifier =
+                Confidential_verify_test.deploy(
+                                Web.chainManager.getWeb3j(),
+                                Web.admin,
+                                Web.chainManager.getGasProvider(),
+                                Web.chainManager.getChainId())
+                        .send();
+    }
+
+    private static byte[] stubTx(int txType, long publicValue) {
+        Confidential.ConfidentialUTXO utxo = new Confidential.ConfidentialUTXO();
+        utxo.txType = (byte) txType;
+        utxo.publicValue = Uint64.of(publicValue);
+        utxo.authorizedAddress = new WasmAddress(Web.admin.getAddress());
+        return RLPCodec.encode(utxo);
+    }
+
+    private static byte[][] stubTxs(int count) {
+        byte[][] txs = new byte[count][];
+        for (int i = 0; i < count; i++) {
+            txs[i] = stubTx(Confidential.ConfidentialTXType.TRANSFER + i % 2, i);
+        }
+        return txs;
+    }
+
+    private static void assertResults(byte[][] txs, Confidential_verify_test.VerifyResult result) {
+        Assertions.assertTrue(result.legal);
+        Assertions.assertEquals(txs.length, result.tx_types.length);
+        for (int i = 0; i < txs.length; i++) {
+            Assertions.assertEquals(
+                    Confidential.ConfidentialTXType.TRANSFER + i % 2, result.tx_types[i]);
+            Assertions.assertEquals(
+                    new WasmAddress(Web.admin.getAddress()), result.authorized[i]);
+        }
+    }
+
+    @Test
+    @Order(1)
+    public void testVerifyOne() throws Exception {
+        Confidential_verify_test.VerifyResult result =
+                verifier.VerifyOne(stubTx(Confidential.ConfidentialTXType.TRANSFER, 0)).send();
+        Assertions.assertTrue(result.legal);
+        Assertions.assertEquals(1, result.calls.value.intValue());
+
+        result = verifier.VerifyOne(new byte[] {1, 2, 3}).send();
+        Assertions.assertFalse(result.legal);
+    }
+
+    @Test
+    @Order(2)
+    public void testVerifyEach() throws Exception {
+        byte[][] txs = stubTxs(8);
+        Confidential_verify_test.VerifyResult result = verifier.VerifyEach(txs).send();
+        assertResults(txs, result);
+        Assertions.assertEquals(txs.length, result.calls.value.intValue());
+    }
+
+    @Test
+    @Order(3)
+    public void testVerifyBatch() throws Exception {
+        byte[][] txs = stubTxs(8);
+        Confidential_verify_test.VerifyResult result = verifier.VerifyBatch(txs).send();
+        assertResults(txs, result);
+        Assertions.assertEquals(1, result.calls.value.intValue());
+    }
+
+    @Test
+    @Order(4)
+    public void testIllegalTx() throws Exception {
+        byte[][] txs = stubTxs(4);
+        txs[2] = new byte[] {1, 2, 3};
+        Assertions.assertFalse(verifier.VerifyEach(txs).send().legal);
+        Assertions.assertFalse(verifier.VerifyBatch(txs).send().legal);
+    }
+}
@@ -8,10 +8,13 @@ import com.alaya.protocol.core.methods.response.Log;
 import com.alaya.rlp.wasm.datatypes.*;
 import com.platon.privacy.confidential.Confidential;
 import com.platon.privacy.contracts.*;
+import com.alaya.abi.wasm.WasmEventEncoder;
 import com.alaya.abi.wasm.WasmEventValues;
+import com.alaya.abi.wasm.datatypes.WasmEvent;
 import com.alaya.crypto.Hash;
 import com.alaya.crypto.Sign;
 import com.alaya.protocol.core.methods.response.TransactionReceipt;
+import com.alaya.protocol.exceptions.TransactionException;
 import com.alaya.rlp.wasm.RLPCodec;
 import com.alaya.tx.WasmContract;
 import com.alaya.utils.Numeric;
@@ -20,6 +23,7 @@ import org.junit.Assert;
 import org.junit.jupiter.api.*;
 import java.math.BigInteger;
 import java.util.Arrays;
+import java.util.List;
 
 @TestMethodOrder(MethodOrderer.OrderAnnotation.class)
 public class PlaintextTokenTest {
@@ -298,9 +302,311 @@ public class PlaintextTokenTest {
     public void testSupportProof() throws Exception {
         long transferProof = Plaintext.currentVersion + Plaintext.transferProof;
         Assertions.assertTrue(token.confidentialToken.SupportProof(Uint32.of(transferProof)).send());
-        transferProof = Plaintext.currentVersion + (1 << 8) + Plaintext.transferProof;
+        transferProof = Plaintext.signerInputsVersion + Plaintext.transferProof;
+        Assertions.assertTrue(token.confidentialToken.SupportProof(Uint32.of(transferProof)).send());
+        transferProof = Plaintext.signerInputsVersion + (1 << 8) + Plaintext.transferProof;
         Assertions.assertFalse(token.confidentialToken.SupportProof(Uint32.of(transferProof)).send());
         transferProof = Plaintext.currentVersion - (1 << 8) + Plaintext.transferProof;
         Assertions.assertFalse(token.confidentialToken.SupportProof(Uint32.of(transferProof)).send());
     }
+
+    @Test
+    @Order(10)
+    public void testTransferSignerInputs() throws Exception {
+        byte[] random20 = Plaintext.PlaintextNote.random();
+        byte[] random21 = Plaintext.PlaintextNote.random();
+        Plaintext.PlaintextUTXO deposit =
+                new Plaintext.PlaintextUTXO(
+                        new Plaintext.PlaintextInputNote[0],
+                        Common.createOutputs(
+                                new Common.Note[] {
+                                    new Common.Note(Web.admin, 20, random20),
+                                    new Common.Note(Web.admin, 21, random21)
+                                }),
+                        new WasmAddress(Web.admin.getAddress()),
+                        Int128.of(-41),
+                        null);
+        token.arc20.Approve(token.acl.GetTokenManager().send(), Uint128.of(41)).send();
+        TransactionReceipt receipt =
+                token.confidentialToken
+                        .Transfer(RLPCodec.encode(Plaintext.createProof(deposit, Web.admin)))
+                        .send();
+        Assertions.assertTrue(receipt.isStatusOK());
+
+        // The inputs of the signer are authorized by the proof signature alone
+        WasmAddress admin = new WasmAddress(Web.admin.getAddress());
+        Plaintext.PlaintextInputNote[] inputs =
+                Plaintext.createSignerInputs(
+                        Arrays.asList(
+                                new Plaintext.PlaintextNote(admin, BigInteger.valueOf(20), random20),
+                                new Plaintext.PlaintextNote(
+                                        admin, BigInteger.valueOf(21), random21)));
+        Plaintext.PlaintextUTXO utxo =
+                new Plaintext.PlaintextUTXO(
+                        inputs,
+                        Common.createOutputs(new Common.Note[] {new Common.Note(Web.admin, 41)}),
+                        new WasmAddress(BigInteger.ZERO),
+                        Int128.of(0),
+                        null);
+
+        Plaintext.PlaintextProof legacy = Plaintext.createProof(utxo, Web.admin);
+        Assertions.assertThrows(
+                TransactionException.class,
+                () -> token.confidentialToken.Transfer(RLPCodec.encode(legacy)).send());
+
+        Plaintext.PlaintextProof proof =
+                Plaintext.createProof(utxo, Web.admin, Plaintext.signerInputsVersion);
+        receipt = token.confidentialToken.Transfer(RLPCodec.encode(proof)).send();
+        Assertions.assertTrue(receipt.isStatusOK());
+        System.out.println("gas used:" + receipt.getGasUsed());
+    }
+
+    @Test
+    @Order(11)
+    public void testTransferFlatProof() throws Exception {
+        byte[] random30 = Plaintext.PlaintextNote.random();
+        Plaintext.PlaintextUTXO deposit =
+                new Plaintext.PlaintextUTXO(
+                        new Plaintext.PlaintextInputNote[0],
+                        Common.createOutputs(
+                                new Common.Note[] {new Common.Note(Web.admin, 30, random30)}),
+                        new WasmAddress(Web.admin.getAddress()),
+                        Int128.of(-30),
+                        null);
+        token.arc20.Approve(token.acl.GetTokenManager().send(), Uint128.of(30)).send();
+        byte[] depositProof =
+                Plaintext.createFlatProof(deposit, Plaintext.transferProof, Web.admin);
+        TransactionReceipt receipt = token.confidentialToken.Transfer(depositProof).send();
+        Assertions.assertTrue(receipt.isStatusOK());
+        System.out.println("flat deposit gas used:" + receipt.getGasUsed());
+
+        WasmAddress admin = new WasmAddress(Web.admin.getAddress());
+        Plaintext.PlaintextUTXO utxo =
+                new Plaintext.PlaintextUTXO(
+                        Plaintext.createSignerInputs(
+                                Arrays.asList(
+                                        new Plaintext.PlaintextNote(
+                                                admin, BigInteger.valueOf(30), random30))),
+                        Common.createOutputs(new Common.Note[] {new Common.Note(Web.admin, 30)}),
+                        new WasmAddress(BigInteger.ZERO),
+                        Int128.of(0),
+                        null);
+        byte[] proof = Plaintext.createFlatProof(utxo, Plaintext.transferProof, Web.admin);
+
+        // The version is part of the signed data, an altered proof is rejected
+        byte[] tampered = Arrays.copyOf(proof, proof.length);
+        tampered[3] = (byte) Plaintext.burnProof;
+        Assertions.assertThrows(
+                TransactionException.class,
+                () -> token.confidentialToken.Transfer(tampered).send());
+
+        receipt = token.confidentialToken.Transfer(proof).send();
+        Assertions.assertTrue(receipt.isStatusOK());
+        System.out.println("flat transfer gas used:" + receipt.getGasUsed());
+    }
+
+    /** Prints the measured gas of transfers with 2, 8 and 32 inputs and as many outputs. */
+    @Test
+    @Order(12)
+    public void testTransferInputs() throws Exception {
+        WasmAddress admin = new WasmAddress(Web.admin.getAddress());
+        for (int count : new int[] {2, 8, 32}) {
+            Common.Note[] notes = new Common.Note[count];
+            for (int i = 0; i < count; i++) {
+                notes[i] = new Common.Note(Web.admin, 1, Plaintext.PlaintextNote.random(), admin);
+            }
+            Plaintext.PlaintextUTXO deposit =
+                    new Plaintext.PlaintextUTXO(
+                            new Plaintext.PlaintextInputNote[0],
+                            Common.createOutputs(notes),
+                            admin,
+                            Int128.of(-count),
+                            null);
+            token.arc20.Approve(token.acl.GetTokenManager().send(), Uint128.of(count)).send();
+            TransactionReceipt receipt =
+                    token.confidentialToken
+                            .Transfer(RLPCodec.encode(Plaintext.createProof(deposit, Web.admin)))
+                            .send();
+            Assertions.assertTrue(receipt.isStatusOK());
+
+            Common.Note[] outputs = new Common.Note[count];
+            for (int i = 0; i < count; i++) {
+                outputs[i] = new Common.Note(Web.admin, 1);
+            }
+            Plaintext.PlaintextUTXO utxo =
+                    new Plaintext.PlaintextUTXO(
+                            Common.createInputs(notes),
+                            Common.createOutputs(outputs),
+                            new WasmAddress(BigInteger.ZERO),
+                            Int128.of(0),
+                            null);
+            receipt =
+                    token.confidentialToken
+                            .Transfer(RLPCodec.encode(Plaintext.createProof(utxo, Web.admin)))
+                            .send();
+            Assertions.assertTrue(receipt.isStatusOK());
+            System.out.println("inputs:" + count + " transfer gas used:" + receipt.getGasUsed());
+        }
+    }
+
+    /**
+     * With signer inputs an approved note still belongs to its owner: the owner spends it on the
+     * proof signature alone and the approval is cleared, while the approved spender always needs
+     * the per-input signature of the owner.
+     */
+    @Test
+    @Order(13)
+    public void testSpendApprovedSignerInputs() throws Exception {
+        byte[] random30 = Plaintext.PlaintextNote.random();
+        WasmAddress admin = new WasmAddress(Web.admin.getAddress());
+        BigInteger thirty = BigInteger.valueOf(30);
+        Plaintext.PlaintextUTXO deposit =
+                new Plaintext.PlaintextUTXO(
+                        new Plaintext.PlaintextInputNote[0],
+                        Common.createOutputs(
+                                new Common.Note[] {new Common.Note(Web.admin, 30, random30)}),
+                        admin,
+                        Int128.of(-30),
+                        null);
+        token.arc20.Approve(token.acl.GetTokenManager().send(), Uint128.of(30)).send();
+        Assertions.assertTrue(
+                token.confidentialToken
+                        .Transfer(RLPCodec.encode(Plaintext.createProof(deposit, Web.admin)))
+                        .send()
+                        .isStatusOK());
+
+        SharedSecret sharedSecret =
+                SharedSecret.generate(
+                        Web.admin.getEcKeyPair().getPrivateKey(),
+                        Web.user1.getEcKeyPair().getPublicKey());
+        Plaintext.PlaintextSpenderNote pn =
+                new Plaintext.PlaintextSpenderNote(
+                        admin, thirty, random30, new WasmAddress(Web.user1.getAddress()));
+        byte[] signature =
+                Plaintext.signToBytes(
+                        Sign.signMessage(RLPCodec.encode(pn), Web.admin.getEcKeyPair()));
+        Plaintext.PlaintextApprove approve =
+                new Plaintext.PlaintextApprove(
+                        admin, thirty, random30, sharedSecret.encryption(signature));
+        Assertions.assertTrue(
+                token.confidentialToken
+                        .Approve(RLPCodec.encode(Plaintext.createApprove(approve, Web.admin)))
+                        .send()
+                        .isStatusOK());
+        byte[] noteHash =
+                Hash.sha3(RLPCodec.encode(new Plaintext.PlaintextNote(admin, thirty, random30)));
+
+        Plaintext.PlaintextUTXO utxo =
+                new Plaintext.PlaintextUTXO(
+                        Plaintext.createSignerInputs(
+                                Arrays.asList(
+                                        new Plaintext.PlaintextNote(admin, thirty, random30))),
+                        Common.createOutputs(new Common.Note[] {new Common.Note(Web.user1, 30)}),
+                        new WasmAddress(BigInteger.ZERO),
+                        Int128.of(0),
+                        null);
+        Plaintext.PlaintextProof foreign =
+                Plaintext.createProof(utxo, Web.user1, Plaintext.signerInputsVersion);
+        Assertions.assertThrows(
+                TransactionException.class,
+                () -> token.confidentialToken.Transfer(RLPCodec.encode(foreign)).send());
+
+        Plaintext.PlaintextProof owned =
+                Plaintext.createProof(utxo, Web.admin, Plaintext.signerInputsVersion);
+        Assertions.assertTrue(
+                token.confidentialToken.Transfer(RLPCodec.encode(owned)).send().isStatusOK());
+        Assertions.assertThrows(
+                Exception.class, () -> token.confidentialToken.GetApproval(noteHash).send());
+    }
+
+    /**
+     * In compact mode a transfer emits a single NoteChangeEvent with the created notes and the
+     * hashes of the destroyed ones, neither the per-note token events nor the detail events of the
+     * validator.
+     */
+    @Test
+    @Order(14)
+    public void testCompactEvents() throws Exception {
+        WasmAddress admin = new WasmAddress(Web.admin.getAddress());
+        Common.Note[] inputs =
+                new Common.Note[] {
+                    new Common.Note(Web.admin, 3, Plaintext.PlaintextNote.random(), admin),
+                    new Common.Note(Web.admin, 4, Plaintext.PlaintextNote.random(), admin)
+                };
+        Plaintext.PlaintextUTXO deposit =
+                new Plaintext.PlaintextUTXO(
+                        new Plaintext.PlaintextInputNote[0],
+                        Common.createOutputs(inputs),
+                        admin,
+                        Int128.of(-7),
+                        null);
+        token.arc20.Approve(token.acl.GetTokenManager().send(), Uint128.of(7)).send();
+        TransactionReceipt receipt =
+                token.confidentialToken
+                        .Transfer(RLPCodec.encode(Plaintext.createProof(deposit, Web.admin)))
+                        .send();
+        Assertions.assertTrue(receipt.isStatusOK());
+        Assertions.assertEquals(
+                2, countLogs(receipt, Plaintext_validator.CREATENOTEDETAILEVENT_EVENT));
+
+        Assertions.assertTrue(token.confidentialToken.SetCompactEvents(true).send().isStatusOK());
+        Assertions.assertTrue(token.confidentialToken.CompactEvents().send());
+        Common.Note[] outputs =
+                new Common.Note[] {
+                    new Common.Note(Web.user1, 5, Plaintext.PlaintextNote.random()),
+                    new Common.Note(Web.admin, 2, Plaintext.PlaintextNote.random())
+                };
+        Plaintext.PlaintextUTXO utxo =
+                new Plaintext.PlaintextUTXO(
+                        Common.createInputs(inputs),
+                        Common.createOutputs(outputs),
+                        new WasmAddress(BigInteger.ZERO),
+                        Int128.of(0),
+                        null);
+        receipt =
+                token.confidentialToken
+                        .Transfer(RLPCodec.encode(Plaintext.createProof(utxo, Web.admin)))
+                        .send();
+        Assertions.assertTrue(receipt.isStatusOK());
+        Assertions.assertEquals(1, receipt.getLogs().size());
+        Assertions.assertEquals(
+                0, countLogs(receipt, Plaintext_validator.CREATENOTEDETAILEVENT_EVENT));
+
+        List<Confidential_token.NoteChangeEventEventResponse> changes =
+                token.confidentialToken.getNoteChangeEventEvents(receipt);
+        Assertions.assertEquals(1, changes.size());
+        Confidential_token.OutputNotes[] created = changes.get(0).arg1;
+        Assertions.assertEquals(outputs.length, created.length);
+        for (int i = 0; i < outputs.length; i++) {
+            Assertions.assertArrayEquals(noteHash(outputs[i]), created[i].hash);
+        }
+        byte[][] destroyed = changes.get(0).arg2;
+        Assertions.assertEquals(inputs.length, destroyed.length);
+        for (int i = 0; i < inputs.length; i++) {
+            Assertions.assertArrayEquals(noteHash(inputs[i]), destroyed[i]);
+        }
+
+        Assertions.assertTrue(token.confidentialToken.SetCompactEvents(false).send().isStatusOK());
+        Assertions.assertFalse(token.confidentialToken.CompactEvents().send());
+    }
+
+    private static byte[] noteHash(Common.Note note) {
+        return Hash.sha3(
+                RLPCodec.encode(
+                        new Plaintext.PlaintextNote(
+                                new WasmAddress(note.owner.getAddress()),
+                                BigInteger.valueOf(note.value),
+                                note.random)));
+    }
+
+    private static int countLogs(TransactionReceipt receipt, WasmEvent event) {
+        String topic = WasmEventEncoder.encode(event);
+        int count = 0;
+        for (Log log : receipt.getLogs()) {
+            if (!log.getTopics().isEmpty() && topic.equals(log.getTopics().get(0))) {
+                count++;
+            }
+        }
+        return count;
+    }
 }
@@ -211,5 +211,122 @@ public class PlaintextValidatorTest {
                         .send());
         Assertions.assertFalse(
                 validator.SupportProof(Uint32.of(Plaintext.currentVersion + (1 << 16))).send());
+
+        // major version 0 predates the handler table, any minor version is served like 1.1
+        long legacyVersion = Plaintext.category;
+        Assertions.assertTrue(
+                validator.SupportProof(Uint32.of(legacyVersion + Plaintext.transferProof)).send());
+        Assertions.assertTrue(
+                validator.SupportProof(
+                                Uint32.of(
+                                        legacyVersion
+                                                + 3 * Plaintext.minor
+                                                + Plaintext.approveProof))
+                        .send());
+        Assertions.assertFalse(validator.SupportProof(Uint32.of(legacyVersion + 4)).send());
+    }
+
+    @Test
+    @Order(7)
+    public void testLegacyVersion() throws Exception {
+        Plaintext.PlaintextOutputNote[] outputs =
+                Common.createOutputs(new Common.Note[] {new Common.Note(Web.admin, 10)});
+        Plaintext.PlaintextUTXO utxo =
+                new Plaintext.PlaintextUTXO(
+                        new Plaintext.PlaintextInputNote[0],
+                        outputs,
+                        new WasmAddress(Web.admin.getAddress()),
+                        Int128.of(-10),
+                        null);
+
+        Plaintext.PlaintextProof proof =
+                Plaintext.createProof(utxo, Web.admin, Plaintext.category + Plaintext.minor);
+        byte[] stream = validator.ValidateProof(RLPCodec.encode(proof)).send();
+        Validator.TransferResult result =
+                RLPCodec.decode(
+                        stream, Validator.TransferResult.class, Web.chainManager.getChainId());
+        Assertions.assertEquals(1, result.outputs.length);
+        Assertions.assertEquals(-10, result.publicValue.value.longValue());
+    }
+
+    /**
+     * Validates a transfer and a mint in one ValidateProofs call, the results match the single
+     * proof results in order and one wrong proof fails the whole batch.
+     */
+    @Test
+    @Order(8)
+    public void testValidateProofs() throws Exception {
+        Plaintext.PlaintextOutputNote[] outputs =
+                Common.createOutputs(new Common.Note[] {new Common.Note(Web.admin, 30)});
+        Plaintext.PlaintextUTXO utxo =
+                new Plaintext.PlaintextUTXO(
+                        new Plaintext.PlaintextInputNote[0],
+                        outputs,
+                        new WasmAddress(Web.admin.getAddress()),
+                        Int128.of(-30),
+                        null);
+        byte[] transfer = RLPCodec.encode(Plaintext.createProof(utxo, Web.admin));
+        Plaintext.PlaintextMint mint = new Plaintext.PlaintextMint(new byte[32], outputs);
+        byte[] minted = RLPCodec.encode(Plaintext.createMint(mint, Web.admin));
+
+        byte[][] results = validator.ValidateProofs(new byte[][] {transfer, minted}).send();
+        Assertions.assertEquals(2, results.length);
+        Assertions.assertArrayEquals(validator.ValidateProof(transfer).send(), results[0]);
+        Assertions.assertArrayEquals(validator.ValidateProof(minted).send(), results[1]);
+        Validator.MintResult result =
+                RLPCodec.decode(
+                        results[1], Validator.MintResult.class, Web.chainManager.getChainId());
+        Assertions.assertEquals(30, result.totalMint.getValue().longValue());
+
+        byte[] wrong = RLPCodec.encode(Plaintext.createMint(mint, Web.user1));
+        Assertions.assertThrows(
+                Exception.class,
+                () -> {
+                    validator.ValidateProofs(new byte[][] {transfer, wrong}).send();
+                });
+    }
+
+    /**
+     * The validator hashes notes from its own RLP encoding, the hashes of a mint must equal sha3
+     * of the RLP of PlaintextNote for values and randoms at every RLP length boundary.
+     */
+    @Test
+    @Order(9)
+    public void testNoteHashEncoding() throws Exception {
+        BigInteger[] values =
+                new BigInteger[] {
+                    BigInteger.ZERO,
+                    BigInteger.ONE,
+                    BigInteger.valueOf(0x7f),
+                    BigInteger.valueOf(0x80),
+                    BigInteger.valueOf(0x100),
+                    BigInteger.ONE.shiftLeft(64),
+                    BigInteger.ONE.shiftLeft(120)
+                };
+        int[] randomSizes = new int[] {0, 1, 1, 32, 55, 56, 60};
+        WasmAddress owner = new WasmAddress(Web.admin.getAddress());
+        Plaintext.PlaintextOutputNote[] outputs = new Plaintext.PlaintextOutputNote[values.length];
+        for (int i = 0; i < outputs.length; i++) {
+            byte[] random = new byte[randomSizes[i]];
+            for (int j = 0; j < random.length; j++) {
+                random[j] = (byte) (i == 1 ? 0x7f : 0x80 + j);
+            }
+            outputs[i] = new Plaintext.PlaintextOutputNote(owner, values[i], random);
+        }
+
+        Plaintext.PlaintextMint mint = new Plaintext.PlaintextMint(new byte[32], outputs);
+        Plaintext.PlaintextProof proof = Plaintext.createMint(mint, Web.admin);
+        byte[] stream = validator.ValidateProof(RLPCodec.encode(proof)).send();
+        Validator.MintResult result =
+                RLPCodec.decode(stream, Validator.MintResult.class, Web.chainManager.getChainId());
+        Assertions.assertEquals(outputs.length, result.outputs.length);
+        for (int i = 0; i < outputs.length; i++) {
+            byte[] expected =
+                    Hash.sha3(
+                            RLPCodec.encode(
+                                    new Plaintext.PlaintextNote(
+                                            owner, outputs[i].value, outputs[i].random)));
+            Assertions.assertArrayEquals(expected, result.outputs[i].noteHash);
+        }
     }
 }
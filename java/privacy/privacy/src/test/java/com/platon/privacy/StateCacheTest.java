@@ -0,0 +1,62 @@
+package com.platon.privacy;
+
+import com.alaya.crypto.Hash;
+import com.alaya.protocol.exceptions.TransactionException;
+import com.platon.privacy.contracts.State_cache_test;
+import org.junit.jupiter.api.*;
+
+/**
+ * The write-combining state cache of the storages, see
+ * contracts/src/test/state_cache_test.cpp. Every action runs on a fresh cache.
+ */
+@TestMethodOrder(MethodOrderer.OrderAnnotation.class)
+public class StateCacheTest {
+    private static final byte[] present = Hash.sha3("present".getBytes());
+    private static final byte[] missing = Hash.sha3("missing".getBytes());
+    private static final byte[] value = "value".getBytes();
+    private static State_cache_test cache;
+
+    @BeforeAll
+    public static void deployContract() throws Exception {
+        cache =
+                State_cache_test.deploy(
+                                Web.chainManager.getWeb3j(),
+                                Web.txManager,
+                                Web.chainManager.getGasProvider(),
+                                Web.chainManager.getChainId())
+                        .send();
+    }
+
+    /** Only the last of two writes to a key in one action reaches the state. */
+    @Test
+    @Order(1)
+    public void testWrite() throws Exception {
+        Assertions.assertTrue(cache.Write(new byte[][] {present}, value).send().isStatusOK());
+        Assertions.assertArrayEquals(value, cache.Read(present).send());
+        Assertions.assertEquals(0, cache.Read(missing).send().length);
+    }
+
+    /**
+     * Hit, miss, read-your-write and erase in one action, the erased key leaves the state and the
+     * key created and erased in the same action is never written.
+     */
+    @Test
+    @Order(2)
+    public void testHitMissErase() throws Exception {
+        Assertions.assertTrue(cache.Check(present, missing).send().isStatusOK());
+        Assertions.assertEquals(0, cache.Read(present).send().length);
+        Assertions.assertEquals(0, cache.Read(missing).send().length);
+        Assertions.assertThrows(
+                TransactionException.class,
+                () -> {
+                    cache.Check(present, missing).send();
+                });
+    }
+
+    /** Lookups of cached keys keep the table size, only a new key past the limit grows it. */
+    @Test
+    @Order(3)
+    public void testGrowth() throws Exception {
+        Assertions.assertTrue(cache.CheckGrowth(Hash.sha3("seed".getBytes())).send().isStatusOK());
+    }
+}
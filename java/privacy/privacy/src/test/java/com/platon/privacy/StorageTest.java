@@ -1,15 +1,20 @@
 package com.platon.privacy;
 
+import com.alaya.crypto.Hash;
 import com.alaya.protocol.core.methods.response.TransactionReceipt;
 import com.alaya.protocol.exceptions.TransactionException;
 import com.alaya.rlp.wasm.RLPCodec;
 import com.alaya.rlp.wasm.datatypes.Int128;
 import com.alaya.rlp.wasm.datatypes.Uint128;
+import com.alaya.rlp.wasm.datatypes.Uint32;
 import com.alaya.rlp.wasm.datatypes.WasmAddress;
 import com.platon.privacy.contracts.Storage;
 import org.junit.jupiter.api.*;
 
 import java.math.BigInteger;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
 
 @TestMethodOrder(MethodOrderer.OrderAnnotation.class)
 public class StorageTest {
@@ -44,6 +49,12 @@ public class StorageTest {
                 5, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
                 1, 1, 1, 1
             };
+    private static final int ownerIndexOption = 1 << 1; // kOwnerIndex
+    private static final int noteExportOption = 1 << 3; // kNoteExport
+    private static final int lazyExportOptions = 1 << 2 | 1 << 3; // kLazyMigrate | kNoteExport
+    private static final int noteTreeOption = 1 << 5; // kNoteTree
+    private static final int treeLeaves = Integer.getInteger("benchmark.leaves", 1024);
+    private static final int leavesPerUpdate = 32;
     private static final WasmAddress adminAddress = new WasmAddress(Web.admin.getAddress());
     private static Storage storage;
 
@@ -230,4 +241,441 @@ public class StorageTest {
         TransactionReceipt receipt = storage.Burn(RLPCodec.encode(result)).send();
         Assertions.assertTrue(receipt.isStatusOK());
     }
+
+    @Test
+    @Order(8)
+    public void testNoteTreeDisabled() {
+        Assertions.assertThrows(
+                Exception.class,
+                () -> {
+                    storage.NoteRoot().send();
+                });
+    }
+
+    private static Storage deployStorage(int options) throws Exception {
+        Storage storage =
+                Storage.deploy(
+                                Web.chainManager.getWeb3j(),
+                                Web.txManager,
+                                Web.chainManager.getGasProvider(),
+                                Web.chainManager.getChainId())
+                        .send();
+        Assertions.assertTrue(
+                storage.CreateRegistryWithOptions(true, Uint32.of(options)).send().isStatusOK());
+        return storage;
+    }
+
+    private static byte[] createNotes(int first, int count) {
+        return createNotes(first, count, adminAddress.getValue());
+    }
+
+    private static byte[] createNotes(int first, int count, byte[] sender) {
+        Validator.OutputNotes[] outputs = new Validator.OutputNotes[count];
+        for (int i = 0; i < count; i++) {
+            byte[] id = BigInteger.valueOf(first + i).toByteArray();
+            outputs[i] = new Validator.OutputNotes(id, Hash.sha3(id), id);
+        }
+        return RLPCodec.encode(
+                new Validator.TransferResult(
+                        new Validator.InputNotes[0],
+                        outputs,
+                        new WasmAddress(BigInteger.ZERO),
+                        Int128.of(0),
+                        sender));
+    }
+
+    /**
+     * Creates the same notes in a storage without and with kNoteTree, prints the measured gas
+     * of every update and checks the root and the paths built off chain from NoteTreeEvent.
+     */
+    @Test
+    @Order(9)
+    public void testNoteTree() throws Exception {
+        Storage plain = deployStorage(0);
+        Storage tree = deployStorage(noteTreeOption);
+        NoteTree notes = new NoteTree();
+        Assertions.assertArrayEquals(notes.root(), tree.NoteRoot().send());
+
+        int first = 100;
+        for (int count : new int[] {1, 2, 8, 32}) {
+            byte[] update = createNotes(first, count);
+            TransactionReceipt without = plain.UpdateNotes(update).send();
+            TransactionReceipt with = tree.UpdateNotes(update).send();
+            Assertions.assertTrue(without.isStatusOK());
+            Assertions.assertTrue(with.isStatusOK());
+            BigInteger extra = with.getGasUsed().subtract(without.getGasUsed());
+            System.out.println(
+                    "notes:" + count
+                            + " gas without tree:" + without.getGasUsed()
+                            + " gas with tree:" + with.getGasUsed()
+                            + " per note:" + extra.divide(BigInteger.valueOf(count)));
+
+            for (Storage.NoteTreeEventEventResponse event : tree.getNoteTreeEventEvents(with)) {
+                notes.add(event.arg1.value.longValue(), event.arg2);
+            }
+            first += count;
+        }
+
+        byte[] root = tree.NoteRoot().send();
+        Assertions.assertEquals(1 + 2 + 8 + 32, notes.size());
+        Assertions.assertArrayEquals(notes.root(), root);
+        for (int i = 0; i < notes.size(); i++) {
+            byte[] leaf = Hash.sha3(BigInteger.valueOf(100 + i).toByteArray());
+            Assertions.assertTrue(NoteTree.verify(leaf, i, notes.path(i), root));
+        }
+        Assertions.assertFalse(NoteTree.verify(threeHash, 3, notes.path(3), root));
+    }
+
+    /**
+     * Measures the state bytes of a note record, a plaintext note has a 20-byte owner, against the
+     * legacy RLP encoding of the same NoteStatus.
+     */
+    @Test
+    @Order(10)
+    public void testNoteRecordSize() throws Exception {
+        Storage records = deployStorage(0);
+        int count = 8;
+        Validator.OutputNotes[] outputs = new Validator.OutputNotes[count];
+        for (int i = 0; i < count; i++) {
+            byte[] id = BigInteger.valueOf(200 + i).toByteArray();
+            outputs[i] = new Validator.OutputNotes(adminAddress.getValue(), Hash.sha3(id), id);
+        }
+        TransactionReceipt receipt =
+                records.UpdateNotes(
+                                RLPCodec.encode(
+                                        new Validator.TransferResult(
+                                                new Validator.InputNotes[0],
+                                                outputs,
+                                                new WasmAddress(BigInteger.ZERO),
+                                                Int128.of(0),
+                                                adminAddress.getValue())))
+                        .send();
+        Assertions.assertTrue(receipt.isStatusOK());
+
+        Storage.StorageStats stats = records.GetStats().send();
+        long recordBytes = stats.state_bytes.value.longValue() / count;
+        byte[] first = Hash.sha3(BigInteger.valueOf(200).toByteArray());
+        long legacyBytes = RLPCodec.encode(records.GetNote(first).send()).length;
+        System.out.println(
+                "note record bytes:" + recordBytes
+                        + " legacy RLP bytes:" + legacyBytes
+                        + " gas per note:"
+                        + receipt.getGasUsed().divide(BigInteger.valueOf(count)));
+        // format(1) | sender id(4) | owner length(2) | owner
+        Assertions.assertEquals(7 + adminAddress.getValue().length, recordBytes);
+        Assertions.assertTrue(recordBytes < legacyBytes);
+    }
+
+    private static byte[] spendNotes(int first, int count) {
+        Validator.InputNotes[] inputs = new Validator.InputNotes[count];
+        for (int i = 0; i < count; i++) {
+            byte[] id = BigInteger.valueOf(first + i).toByteArray();
+            inputs[i] = new Validator.InputNotes(id, Hash.sha3(id));
+        }
+        return RLPCodec.encode(
+                new Validator.TransferResult(
+                        inputs,
+                        new Validator.OutputNotes[0],
+                        new WasmAddress(BigInteger.ZERO),
+                        Int128.of(0),
+                        adminAddress.getValue()));
+    }
+
+    /**
+     * Spends the same number of unapproved and approved notes and prints the measured gas per
+     * input. An approved input still clears its approval key, which unapproved inputs skip.
+     * GetApproval serves the approval until the note is spent.
+     */
+    @Test
+    @Order(11)
+    public void testApprovedInputGas() throws Exception {
+        Storage approvals = deployStorage(0);
+        int count = 8;
+        Assertions.assertTrue(
+                approvals.UpdateNotes(createNotes(300, 2 * count)).send().isStatusOK());
+        for (int i = 0; i < count; i++) {
+            byte[] hash = Hash.sha3(BigInteger.valueOf(300 + count + i).toByteArray());
+            Validator.ApproveResult result =
+                    new Validator.ApproveResult(hash, four, adminAddress.getValue());
+            Assertions.assertTrue(approvals.Approve(RLPCodec.encode(result)).send().isStatusOK());
+        }
+        byte[] last = Hash.sha3(BigInteger.valueOf(300 + 2 * count - 1).toByteArray());
+        Assertions.assertArrayEquals(four, approvals.GetApproval(last).send());
+        Assertions.assertEquals(count, approvals.GetStats().send().approvals.value.intValue());
+
+        TransactionReceipt unapproved = approvals.UpdateNotes(spendNotes(300, count)).send();
+        TransactionReceipt approved = approvals.UpdateNotes(spendNotes(300 + count, count)).send();
+        Assertions.assertTrue(unapproved.isStatusOK());
+        Assertions.assertTrue(approved.isStatusOK());
+        BigInteger inputs = BigInteger.valueOf(count);
+        System.out.println(
+                "gas per unapproved input:" + unapproved.getGasUsed().divide(inputs)
+                        + " approved input:" + approved.getGasUsed().divide(inputs));
+        Assertions.assertTrue(unapproved.getGasUsed().compareTo(approved.getGasUsed()) < 0);
+        Assertions.assertEquals(0, approvals.GetStats().send().approvals.value.intValue());
+        Assertions.assertThrows(
+                Exception.class,
+                () -> {
+                    approvals.GetApproval(last).send();
+                });
+    }
+
+    /**
+     * Commits two transfers in one UpdateNotesBatch call, the second spends a note created by the
+     * first, then checks that a batch spending the same note twice is rejected as a whole.
+     */
+    @Test
+    @Order(12)
+    public void testUpdateNotesBatch() throws Exception {
+        Storage batch = deployStorage(0);
+        byte[][] transfers = new byte[][] {createNotes(400, 2), spendNotes(401, 1)};
+        Assertions.assertTrue(
+                batch.UpdateNotesBatch(RLPCodec.encode(transfers)).send().isStatusOK());
+
+        byte[] kept = Hash.sha3(BigInteger.valueOf(400).toByteArray());
+        Assertions.assertArrayEquals(kept, batch.GetNote(kept).send().hash);
+        byte[] spent = Hash.sha3(BigInteger.valueOf(401).toByteArray());
+        Assertions.assertThrows(
+                Exception.class,
+                () -> {
+                    batch.GetNote(spent).send();
+                });
+
+        byte[][] doubleSpend = new byte[][] {spendNotes(400, 1), spendNotes(400, 1)};
+        Assertions.assertThrows(
+                TransactionException.class,
+                () -> {
+                    batch.UpdateNotesBatch(RLPCodec.encode(doubleSpend)).send();
+                });
+        Assertions.assertArrayEquals(kept, batch.GetNote(kept).send().hash);
+    }
+
+    /**
+     * Creates notes from two senders and checks that GetNote resolves the interned sender of every
+     * note. Only the first note of a sender adds it to the sender table.
+     */
+    @Test
+    @Order(13)
+    public void testSenderInterning() throws Exception {
+        Storage senders = deployStorage(0);
+        byte[] other = new WasmAddress(BigInteger.valueOf(0xabcdef)).getValue();
+        TransactionReceipt first = senders.UpdateNotes(createNotes(500, 1, other)).send();
+        TransactionReceipt again = senders.UpdateNotes(createNotes(501, 1, other)).send();
+        Assertions.assertTrue(
+                senders.UpdateNotes(createNotes(502, 1, adminAddress.getValue()))
+                        .send()
+                        .isStatusOK());
+        Assertions.assertTrue(first.getGasUsed().compareTo(again.getGasUsed()) > 0);
+
+        byte[][] expected = new byte[][] {other, other, adminAddress.getValue()};
+        for (int i = 0; i < expected.length; i++) {
+            byte[] hash = Hash.sha3(BigInteger.valueOf(500 + i).toByteArray());
+            Assertions.assertArrayEquals(expected[i], senders.GetNote(hash).send().sender);
+        }
+    }
+
+    /** GetNotes answers in the order of the hashes, with a zero hash for a missing note. */
+    @Test
+    @Order(14)
+    public void testGetNotes() throws Exception {
+        Storage lookup = deployStorage(0);
+        Assertions.assertTrue(lookup.UpdateNotes(createNotes(600, 2)).send().isStatusOK());
+        byte[] first = Hash.sha3(BigInteger.valueOf(600).toByteArray());
+        byte[] second = Hash.sha3(BigInteger.valueOf(601).toByteArray());
+
+        Storage.NoteStatus[] statuses =
+                lookup.GetNotes(new byte[][] {second, oneHash, first}).send();
+        Assertions.assertEquals(3, statuses.length);
+        Assertions.assertArrayEquals(second, statuses[0].hash);
+        Assertions.assertArrayEquals(new byte[32], statuses[1].hash);
+        Assertions.assertArrayEquals(first, statuses[2].hash);
+        Assertions.assertArrayEquals(BigInteger.valueOf(600).toByteArray(), statuses[2].owner);
+        Assertions.assertArrayEquals(adminAddress.getValue(), statuses[2].sender);
+    }
+
+    /**
+     * Pages through the notes of one owner in a kOwnerIndex storage, the notes of another owner and
+     * spent notes are not listed.
+     */
+    @Test
+    @Order(15)
+    public void testGetNotesByOwner() throws Exception {
+        Storage index = deployStorage(ownerIndexOption);
+        byte[][] hashes = new byte[4][];
+        Validator.OutputNotes[] outputs = new Validator.OutputNotes[hashes.length];
+        for (int i = 0; i < hashes.length; i++) {
+            hashes[i] = Hash.sha3(BigInteger.valueOf(700 + i).toByteArray());
+            outputs[i] = new Validator.OutputNotes(i == 1 ? two : one, hashes[i], one);
+        }
+        byte[] create =
+                RLPCodec.encode(
+                        new Validator.TransferResult(
+                                new Validator.InputNotes[0],
+                                outputs,
+                                new WasmAddress(BigInteger.ZERO),
+                                Int128.of(0),
+                                adminAddress.getValue()));
+        Assertions.assertTrue(index.UpdateNotes(create).send().isStatusOK());
+        byte[] spend =
+                RLPCodec.encode(
+                        new Validator.TransferResult(
+                                new Validator.InputNotes[] {
+                                    new Validator.InputNotes(one, hashes[2])
+                                },
+                                new Validator.OutputNotes[0],
+                                new WasmAddress(BigInteger.ZERO),
+                                Int128.of(0),
+                                adminAddress.getValue()));
+        Assertions.assertTrue(index.UpdateNotes(spend).send().isStatusOK());
+
+        Storage.NotePage page = index.GetNotesByOwner(one, new byte[32], Uint32.of(1)).send();
+        Assertions.assertEquals(1, page.notes.length);
+        Assertions.assertArrayEquals(hashes[0], page.notes[0]);
+        page = index.GetNotesByOwner(one, page.cursor, Uint32.of(1)).send();
+        Assertions.assertEquals(1, page.notes.length);
+        Assertions.assertArrayEquals(hashes[3], page.notes[0]);
+        Assertions.assertArrayEquals(new byte[32], page.cursor);
+
+        page = index.GetNotesByOwner(two, new byte[32], Uint32.of(10)).send();
+        Assertions.assertEquals(1, page.notes.length);
+        Assertions.assertArrayEquals(hashes[1], page.notes[0]);
+    }
+
+    /**
+     * Fills a kNoteTree storage with the number of leaves of the benchmark.leaves property, a
+     * multiple of 32, and prints the measured gas per leaf each time the tree doubles. Run with
+     * -Dbenchmark.leaves=1048576 for the 1M leaf measurement.
+     */
+    @Test
+    @Order(16)
+    public void testNoteTreeScale() throws Exception {
+        Assertions.assertEquals(0, treeLeaves % leavesPerUpdate);
+        Storage tree = deployStorage(noteTreeOption);
+        NoteTree notes = new NoteTree();
+        int first = 10_000_000;
+        for (int size = 0; size < treeLeaves; size += leavesPerUpdate) {
+            TransactionReceipt receipt =
+                    tree.UpdateNotes(createNotes(first + size, leavesPerUpdate)).send();
+            Assertions.assertTrue(receipt.isStatusOK());
+            for (Storage.NoteTreeEventEventResponse event : tree.getNoteTreeEventEvents(receipt)) {
+                notes.add(event.arg1.value.longValue(), event.arg2);
+            }
+            if (Integer.bitCount(size / leavesPerUpdate + 1) == 1) {
+                System.out.println(
+                        "tree leaves:" + (size + leavesPerUpdate)
+                                + " gas per leaf:"
+                                + receipt.getGasUsed()
+                                        .divide(BigInteger.valueOf(leavesPerUpdate)));
+            }
+        }
+
+        byte[] root = tree.NoteRoot().send();
+        Assertions.assertEquals(treeLeaves, notes.size());
+        Assertions.assertArrayEquals(notes.root(), root);
+        long last = treeLeaves - 1;
+        byte[] leaf = Hash.sha3(BigInteger.valueOf(first + last).toByteArray());
+        Assertions.assertTrue(NoteTree.verify(leaf, last, notes.path(last), root));
+    }
+
+    /**
+     * Migrates a kLazyMigrate storage, reads and spends inherited notes through the successor,
+     * then drains the remaining notes forward in pages until DrainOldStorage reports the end.
+     */
+    @Test
+    @Order(17)
+    public void testLazyMigrate() throws Exception {
+        Storage old = deployStorage(lazyExportOptions);
+        Storage template = deployStorage(0);
+        int count = 5;
+        Assertions.assertTrue(old.UpdateNotes(createNotes(700, count)).send().isStatusOK());
+
+        TransactionReceipt receipt =
+                old.Migrate(new WasmAddress(template.getContractAddress())).send();
+        Assertions.assertTrue(receipt.isStatusOK());
+        // The address is in the last 20 bytes of the topic
+        String topic = old.getStorageMigrateEventEvents(receipt).get(0).topic2;
+        WasmAddress address =
+                new WasmAddress(new BigInteger(topic.substring(topic.length() - 40), 16));
+        Storage successor =
+                Storage.load(
+                        address.getAddress(),
+                        Web.chainManager.getWeb3j(),
+                        Web.txManager,
+                        Web.chainManager.getGasProvider(),
+                        Web.chainManager.getChainId());
+        Assertions.assertThrows(
+                TransactionException.class,
+                () -> {
+                    old.UpdateNotes(createNotes(710, 1)).send();
+                });
+
+        byte[] first = Hash.sha3(BigInteger.valueOf(700).toByteArray());
+        Assertions.assertArrayEquals(first, successor.GetNote(first).send().hash);
+        Assertions.assertTrue(successor.UpdateNotes(spendNotes(700, 1)).send().isStatusOK());
+        Assertions.assertThrows(
+                Exception.class,
+                () -> {
+                    successor.GetNote(first).send();
+                });
+        Assertions.assertEquals(0, successor.GetStats().send().live_notes.value.intValue());
+
+        Assertions.assertTrue(successor.DrainOldStorage(Uint32.of(2)).send().isStatusOK());
+        Assertions.assertEquals(1, successor.GetStats().send().live_notes.value.intValue());
+        Assertions.assertTrue(successor.DrainOldStorage(Uint32.of(0)).send().isStatusOK());
+        Assertions.assertEquals(
+                count - 1, successor.GetStats().send().live_notes.value.intValue());
+        Assertions.assertTrue(successor.DrainOldStorage(Uint32.of(0)).send().isStatusOK());
+        Assertions.assertEquals(
+                count - 1, successor.GetStats().send().live_notes.value.intValue());
+
+        Assertions.assertTrue(successor.UpdateNotes(spendNotes(701, 1)).send().isStatusOK());
+        Assertions.assertEquals(
+                count - 2, successor.GetStats().send().live_notes.value.intValue());
+    }
+
+    /**
+     * Pages through the live notes of a kNoteExport storage and checks the creation order, the
+     * skipped spent note and the state version, which only changes with the notes.
+     */
+    @Test
+    @Order(18)
+    public void testExportNotes() throws Exception {
+        Storage export = deployStorage(noteExportOption);
+        int count = 5;
+        Assertions.assertTrue(export.UpdateNotes(createNotes(800, count)).send().isStatusOK());
+        Assertions.assertTrue(export.UpdateNotes(spendNotes(802, 1)).send().isStatusOK());
+
+        List<byte[]> hashes = new ArrayList<>();
+        byte[] cursor = new byte[32];
+        long version = -1;
+        do {
+            Storage.NoteExport page = export.ExportNotes(cursor, Uint32.of(2)).send();
+            Assertions.assertTrue(page.notes.length <= 2);
+            if (version >= 0) {
+                Assertions.assertEquals(version, page.version.value.longValue());
+            }
+            version = page.version.value.longValue();
+            for (Storage.NoteStatus note : page.notes) {
+                hashes.add(note.hash);
+            }
+            cursor = page.cursor;
+        } while (!Arrays.equals(cursor, new byte[32]));
+
+        int[] live = new int[] {800, 801, 803, 804};
+        Assertions.assertEquals(live.length, hashes.size());
+        for (int i = 0; i < live.length; i++) {
+            Assertions.assertArrayEquals(
+                    Hash.sha3(BigInteger.valueOf(live[i]).toByteArray()), hashes.get(i));
+        }
+
+        Assertions.assertTrue(export.UpdateNotes(spendNotes(800, 1)).send().isStatusOK());
+        Storage.NoteExport after = export.ExportNotes(new byte[32], Uint32.of(0)).send();
+        Assertions.assertEquals(live.length - 1, after.notes.length);
+        Assertions.assertNotEquals(version, after.version.value.longValue());
+        Assertions.assertThrows(
+                Exception.class,
+                () -> {
+                    storage.ExportNotes(new byte[32], Uint32.of(0)).send();
+                });
+    }
 }